@@ -0,0 +1,113 @@
+/* **************************** c202-bench.c ******************************** */
+/*  Course: Algorithms (IAL) - FIT VUT in Brno                                */
+/*  Task: c202 - Stack of characters in an array                              */
+/*  Throughput benchmarks for the stacks of c202                              */
+/* ************************************************************************** */
+
+/* Benchmarks are not part of the tests, their output depends on the machine. */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "c202.h"
+#include "c202-lockfree.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+int error_flag;
+int solved;
+
+/** Number of push/pop pairs performed by every thread. */
+#define OPERATIONS_PER_THREAD 1000000
+/** Highest number of threads to measure, the mutex stack must not overflow. */
+#define MAX_THREADS 16
+
+/******************************************************************************
+ * Helper functions                                                           *
+ ******************************************************************************/
+
+/** Returns the current time in seconds. */
+double now( void ) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/** Runs 'threads' copies of 'worker' and returns the elapsed time in seconds. */
+double run_threads( int threads, void *(*worker)( void * ), void *arg ) {
+	pthread_t ids[MAX_THREADS];
+	double start = now();
+	for (int i = 0; i < threads; i++)
+		pthread_create(&ids[i], NULL, worker, arg);
+	for (int i = 0; i < threads; i++)
+		pthread_join(ids[i], NULL);
+	return now() - start;
+}
+
+/******************************************************************************
+ * Measured workloads                                                         *
+ ******************************************************************************/
+
+Stack mutexStack;
+pthread_mutex_t mutexStackLock = PTHREAD_MUTEX_INITIALIZER;
+
+/** Push/pop pairs on the c202 array stack guarded by a single mutex. */
+void *mutex_worker( void *arg ) {
+	(void) arg;
+	for (int i = 0; i < OPERATIONS_PER_THREAD; i++)
+	{
+		char c;
+		pthread_mutex_lock(&mutexStackLock);
+		Stack_Push(&mutexStack, 'a' + i % 26);
+		pthread_mutex_unlock(&mutexStackLock);
+		pthread_mutex_lock(&mutexStackLock);
+		Stack_Top(&mutexStack, &c);
+		Stack_Pop(&mutexStack);
+		pthread_mutex_unlock(&mutexStackLock);
+	}
+	return NULL;
+}
+
+/** Push/pop pairs on the lock-free stack. */
+void *lockfree_worker( void *arg ) {
+	LFStack *stack = arg;
+	for (int i = 0; i < OPERATIONS_PER_THREAD; i++)
+	{
+		char c;
+		LFStack_Push(stack, 'a' + i % 26);
+		LFStack_Pop(stack, &c);
+	}
+	return NULL;
+}
+
+/******************************************************************************
+ * Actual benchmarking                                                        *
+ ******************************************************************************/
+
+int main() {
+	printf("C202 - Stack Contention Benchmark\n");
+	printf("---------------------------------\n");
+	printf("%8s %20s %20s\n", "threads", "mutex [Mops/s]", "lock-free [Mops/s]");
+
+	LFStack lockfreeStack;
+	LFStack_Init(&lockfreeStack, MAX_THREADS);
+
+	for (int threads = 1; threads <= MAX_THREADS; threads *= 2)
+	{
+		double operations = 2.0 * OPERATIONS_PER_THREAD * threads;
+
+		Stack_Init(&mutexStack);
+		double mutexTime = run_threads(threads, mutex_worker, NULL);
+		double lockfreeTime = run_threads(threads, lockfree_worker, &lockfreeStack);
+
+		printf("%8d %20.2f %20.2f\n", threads, operations / mutexTime / 1e6,
+		       operations / lockfreeTime / 1e6);
+	}
+
+	LFStack_Dispose(&lockfreeStack);
+	return (0);
+}
+
+/* End of c202-bench.c */
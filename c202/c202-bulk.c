@@ -0,0 +1,167 @@
+/**
+ * @file c202-bulk.c
+ * @brief Block operations on the character stack implementation file.
+ * @details Implements the operations declared in c202-bulk.h on top of the static array
+ *          of the c202 stack.
+ *
+ *          The functions implemented are:
+ *          - Stack_PushN:       Adds a block of items to the top of the stack.
+ *          - Stack_PopN:        Removes a block of items from the top of the stack.
+ *          - Stack_PeekN:       Reads a block of items from the top of the stack.
+ *          - Stack_FindFromTop: Counts the items above the topmost occurrence of an item.
+ *
+ * @code
+ * // Using example
+ * Stack s;
+ * char block[3];
+ * Stack_Init(&s);
+ * Stack_PushN(&s, "a(bc", 4);
+ * int above = Stack_FindFromTop(&s, '(');  // 2
+ * Stack_PeekN(&s, block, above);           // "bc"
+ * Stack_PopN(&s, above + 1);               // Only 'a' is left
+ * @endcode
+ *
+ * @see c202-bulk.h for the declarations and c202.h for the stack.
+ *
+ * @see https://github.com/Jekwwer/IAL-Project01-2021 for the project repository.
+ */
+
+#include "c202-bulk.h"
+#include <string.h>
+
+/**
+ * @brief Inserts a block of characters on top of the stack.
+ * 
+ * @details Copies 'count' characters from 'data' onto the stack with a single capacity
+ *          check and a single memcpy. The characters are pushed in array order, so
+ *          data[count - 1] ends up on the top of the stack. The result is the same as
+ *          calling Stack_Push for each character of the block, one after another.
+ * 
+ * @param stack A pointer to the stack structure where the characters will be inserted.
+ * @param data The characters to insert onto the stack.
+ * @param count The number of characters to insert.
+ * 
+ * @pre The stack should be initialized and have room for 'count' more characters.
+ * 
+ * @post If there is enough room, topIndex is increased by 'count'. Otherwise Stack_Error
+ *       is called with SERR_PUSH and the stack is not changed at all, unlike a sequence
+ *       of Stack_Push calls which would fill the stack up to its capacity.
+ * 
+ * @code
+ * Stack_PushN(&s, "abc", 3); // 'c' is now on the top
+ * @endcode
+ * 
+ * @return This function does not return a value.
+ */
+void Stack_PushN(Stack *stack, const char *data, int count) {
+
+    if (count <= 0) {
+        return;
+    }
+
+    if (stack->topIndex + count > STACK_SIZE - 1) {
+        Stack_Error(SERR_PUSH);
+    } else {
+        memcpy(&stack->array[stack->topIndex + 1], data, count);
+        stack->topIndex += count;
+    }
+}
+
+/**
+ * @brief Removes a block of items from the top of the stack.
+ * 
+ * @details Decrements the top index by 'count' at once. If the stack holds fewer items,
+ *          it is emptied, which matches the silent behaviour of Stack_Pop on an empty
+ *          stack.
+ * 
+ * @param stack A pointer to the stack structure from which the items will be removed.
+ * @param count The number of items to remove.
+ * 
+ * @pre The stack should be initialized before this function is called.
+ * 
+ * @post At most 'count' items are removed from the top of the stack.
+ * 
+ * @code
+ * Stack_PopN(&s, 3); // Same as three calls of Stack_Pop
+ * @endcode
+ * 
+ * @return This function does not return a value.
+ */
+void Stack_PopN(Stack *stack, int count) {
+
+    if (count <= 0) {
+        return;
+    }
+
+    stack->topIndex = stack->topIndex >= count ? stack->topIndex - count : -1;
+}
+
+/**
+ * @brief Reads a block of characters from the top of the stack without removing them.
+ * 
+ * @details Copies the 'count' topmost characters into 'dataPtr' with a single memcpy.
+ *          The block keeps the stack order, so dataPtr[count - 1] receives the top of
+ *          the stack and dataPtr[0] the deepest character of the block. Callers that
+ *          need the pop order have to read the buffer backwards.
+ * 
+ * @param stack Pointer to the initialized stack structure to be queried.
+ * @param dataPtr Pointer to a buffer of at least 'count' characters.
+ * @param count The number of characters to read.
+ * 
+ * @pre The stack must hold at least 'count' characters, otherwise Stack_Error is called
+ *      with SERR_TOP and the buffer is left untouched.
+ * 
+ * @post The state of the stack remains unchanged.
+ * 
+ * @code
+ * char block[2];
+ * Stack_PeekN(&s, block, 2);
+ * Stack_PopN(&s, 2);
+ * @endcode
+ * 
+ * @return This function does not return a value.
+ */
+void Stack_PeekN(const Stack *stack, char *dataPtr, int count) {
+
+    if (count <= 0) {
+        return;
+    }
+
+    if (count > stack->topIndex + 1) {
+        Stack_Error(SERR_TOP);
+    } else {
+        memcpy(dataPtr, &stack->array[stack->topIndex - count + 1], count);
+    }
+}
+
+/**
+ * @brief Finds the occurrence of a character closest to the top of the stack.
+ * 
+ * @details Scans the stack from the top down and counts the characters above the first
+ *          match. Like strcspn, the function returns the number of characters on the
+ *          stack when there is no match, so the result can always be passed to
+ *          Stack_PeekN and Stack_PopN.
+ * 
+ * @param stack Pointer to the initialized stack structure to be searched.
+ * @param data The character to look for.
+ * 
+ * @post The state of the stack remains unchanged.
+ * 
+ * @code
+ * int above = Stack_FindFromTop(&s, '(');
+ * Stack_PopN(&s, above + 1); // Drops everything up to and including the '('
+ * @endcode
+ * 
+ * @retval int Number of characters above the topmost 'data', or the number of
+ *             characters on the stack if it does not contain 'data'.
+ */
+int Stack_FindFromTop(const Stack *stack, char data) {
+
+    int index = stack->topIndex;
+    while (index >= 0 && stack->array[index] != data) {
+        index--;
+    }
+    return stack->topIndex - index;
+}
+
+/* End of c202-bulk.c */
@@ -0,0 +1,32 @@
+/**
+ * @file c202-bulk.h
+ * @brief Block operations on the character stack of c202.h.
+ * @details Declares operations that move several characters between a buffer and the
+ *          stack with a single bounds check and a single memcpy, instead of one call of
+ *          Stack_Push, Stack_Top or Stack_Pop per character, and a search that tells how
+ *          deep a character lies below the top without popping anything.
+ *
+ *          The operations work on the same Stack structure and report errors through
+ *          the same Stack_Error, so they can be mixed freely with the c202.h operations.
+ *
+ * @see c202.h for the stack the operations work on.
+ *
+ * @see https://github.com/Jekwwer/IAL-Project01-2021 for the project repository.
+ */
+
+#ifndef _STACK_BULK_H_
+#define _STACK_BULK_H_
+
+#include "c202.h"
+
+void Stack_PushN( Stack *, const char *, int );
+
+void Stack_PopN( Stack *, int );
+
+void Stack_PeekN( const Stack *, char *, int );
+
+int Stack_FindFromTop( const Stack *, char );
+
+#endif
+
+/* End of c202-bulk.h */
@@ -0,0 +1,190 @@
+/**
+ * @file c202-generic.h
+ * @brief Header-only typed stacks generated from the c202 stack design.
+ * @details The c202 stack stores only characters and every operation is an out-of-line
+ *          call into c202.c. This header generates a stack type for an arbitrary element
+ *          type together with static inline operations, so the compiler can inline them
+ *          into the caller and keep the top of the stack in a register.
+ *
+ *          Two generators are provided:
+ *          - STACK_DEFINE:         Fixed capacity stack stored in an embedded array.
+ *          - STACK_DEFINE_DYNAMIC: Heap-backed stack whose array doubles when it is full.
+ *
+ *          Both generate the operations Name_Init, Name_IsEmpty, Name_IsFull, Name_Top,
+ *          Name_Pop and Name_Push with the same semantics as their c202 counterparts.
+ *          The dynamic variant additionally generates Name_Dispose.
+ *
+ * @note Errors are reported through Stack_Error from c202.c using the existing SERR_*
+ *       codes, so the error path stays out of line while the fast path is fully inlined.
+ *
+ * @code
+ * // Using example
+ * STACK_DEFINE(IntStack, int, 64)
+ *
+ * IntStack s;
+ * IntStack_Init(&s);
+ * IntStack_Push(&s, 42);
+ * int top;
+ * IntStack_Top(&s, &top);
+ * IntStack_Pop(&s);
+ * @endcode
+ *
+ * @see c202.h for the error codes and the original character stack.
+ *
+ * @see https://github.com/Jekwwer/IAL-Project01-2021 for the project repository.
+ */
+
+#ifndef _STACK_GENERIC_H_
+#define _STACK_GENERIC_H_
+
+#include <limits.h>
+#include <stdlib.h>
+
+#include "c202.h"
+
+/**
+ * @brief Generates a fixed capacity stack of the given element type.
+ *
+ * @details Defines the structure Name holding an embedded array of Capacity elements
+ *          and the index of the top element, followed by its static inline operations.
+ *          Unlike the c202 stack, the capacity is a compile-time constant of the type,
+ *          which lets the compiler fold the fullness check.
+ *
+ * @param Name Name of the generated type, also used as the prefix of the operations.
+ * @param Type Element type stored in the stack.
+ * @param Capacity Maximum number of elements the stack can hold.
+ */
+#define STACK_DEFINE(Name, Type, Capacity)                                         \
+    typedef struct {                                                               \
+        Type array[Capacity];                                                      \
+        int topIndex;                                                              \
+    } Name;                                                                        \
+                                                                                   \
+    static inline void Name##_Init(Name *stack) {                                  \
+        if (stack == NULL) {                                                       \
+            Stack_Error(SERR_INIT);                                                \
+        } else {                                                                   \
+            stack->topIndex = -1;                                                  \
+        }                                                                          \
+    }                                                                              \
+                                                                                   \
+    static inline int Name##_IsEmpty(const Name *stack) {                          \
+        return stack->topIndex == -1;                                              \
+    }                                                                              \
+                                                                                   \
+    static inline int Name##_IsFull(const Name *stack) {                           \
+        return stack->topIndex == (Capacity) - 1;                                  \
+    }                                                                              \
+                                                                                   \
+    static inline void Name##_Top(const Name *stack, Type *dataPtr) {              \
+        if (Name##_IsEmpty(stack)) {                                               \
+            Stack_Error(SERR_TOP);                                                 \
+        } else {                                                                   \
+            *dataPtr = stack->array[stack->topIndex];                              \
+        }                                                                          \
+    }                                                                              \
+                                                                                   \
+    static inline void Name##_Pop(Name *stack) {                                   \
+        if (!Name##_IsEmpty(stack)) {                                              \
+            stack->topIndex--;                                                     \
+        }                                                                          \
+    }                                                                              \
+                                                                                   \
+    static inline void Name##_Push(Name *stack, Type data) {                       \
+        if (Name##_IsFull(stack)) {                                                \
+            Stack_Error(SERR_PUSH);                                                \
+        } else {                                                                   \
+            stack->array[++stack->topIndex] = data;                                \
+        }                                                                          \
+    }
+
+/**
+ * @brief Generates a growable heap-backed stack of the given element type.
+ *
+ * @details Defines the structure Name holding a pointer to a heap array, the index of
+ *          the top element and the current capacity. Name_Init takes the initial
+ *          capacity, Name_Push doubles the array when it is full and Name_Dispose
+ *          releases it. Name_IsFull only reports a full stack once doubling the
+ *          capacity would overflow an int; a push that fails to allocate the larger
+ *          array reports SERR_PUSH.
+ *
+ * @param Name Name of the generated type, also used as the prefix of the operations.
+ * @param Type Element type stored in the stack.
+ *
+ * @warning Pointers to elements obtained before a push may be invalidated by the growth
+ *          of the array.
+ */
+#define STACK_DEFINE_DYNAMIC(Name, Type)                                           \
+    typedef struct {                                                               \
+        Type *array;                                                               \
+        int topIndex;                                                              \
+        int capacity;                                                              \
+    } Name;                                                                        \
+                                                                                   \
+    static inline void Name##_Init(Name *stack, int capacity) {                    \
+        if (stack == NULL) {                                                       \
+            Stack_Error(SERR_INIT);                                                \
+            return;                                                                \
+        }                                                                          \
+        if (capacity < 1) {                                                        \
+            capacity = 1;                                                          \
+        }                                                                          \
+        stack->array = (Type *) malloc(sizeof(Type) * capacity);                   \
+        stack->topIndex = -1;                                                      \
+        stack->capacity = stack->array == NULL ? 0 : capacity;                     \
+        if (stack->array == NULL) {                                                \
+            Stack_Error(SERR_INIT);                                                \
+        }                                                                          \
+    }                                                                              \
+                                                                                   \
+    static inline void Name##_Dispose(Name *stack) {                               \
+        free(stack->array);                                                        \
+        stack->array = NULL;                                                       \
+        stack->topIndex = -1;                                                      \
+        stack->capacity = 0;                                                       \
+    }                                                                              \
+                                                                                   \
+    static inline int Name##_IsEmpty(const Name *stack) {                          \
+        return stack->topIndex == -1;                                              \
+    }                                                                              \
+                                                                                   \
+    static inline int Name##_IsFull(const Name *stack) {                           \
+        return stack->topIndex == stack->capacity - 1 &&                           \
+               stack->capacity > INT_MAX / 2;                                      \
+    }                                                                              \
+                                                                                   \
+    static inline void Name##_Top(const Name *stack, Type *dataPtr) {              \
+        if (Name##_IsEmpty(stack)) {                                               \
+            Stack_Error(SERR_TOP);                                                 \
+        } else {                                                                   \
+            *dataPtr = stack->array[stack->topIndex];                              \
+        }                                                                          \
+    }                                                                              \
+                                                                                   \
+    static inline void Name##_Pop(Name *stack) {                                   \
+        if (!Name##_IsEmpty(stack)) {                                              \
+            stack->topIndex--;                                                     \
+        }                                                                          \
+    }                                                                              \
+                                                                                   \
+    static inline void Name##_Push(Name *stack, Type data) {                       \
+        if (stack->topIndex == stack->capacity - 1) {                              \
+            if (stack->capacity > INT_MAX / 2) {                                   \
+                Stack_Error(SERR_PUSH);                                            \
+                return;                                                            \
+            }                                                                      \
+            int capacity = stack->capacity > 0 ? stack->capacity * 2 : 1;          \
+            Type *array = (Type *) realloc(stack->array, sizeof(Type) * capacity); \
+            if (array == NULL) {                                                   \
+                Stack_Error(SERR_PUSH);                                            \
+                return;                                                            \
+            }                                                                      \
+            stack->array = array;                                                  \
+            stack->capacity = capacity;                                            \
+        }                                                                          \
+        stack->array[++stack->topIndex] = data;                                    \
+    }
+
+#endif
+
+/* End of c202-generic.h */
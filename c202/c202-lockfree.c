@@ -0,0 +1,247 @@
+/**
+ * @file c202-lockfree.c
+ * @brief Lock-free character stack implementation file.
+ * @details Implements the Treiber stack declared in c202-lockfree.h. Both the stack and
+ *          its free list are manipulated by the same two helpers, which pop or push one
+ *          node index with a single compare-and-swap on a tagged 64-bit word.
+ *
+ *          The functions implemented are:
+ *          - LFStack_Init:    Allocates the nodes and puts all of them into the free list.
+ *          - LFStack_Dispose: Releases the nodes.
+ *          - LFStack_IsEmpty: Checks if the stack is empty.
+ *          - LFStack_Top:     Reads the character on the top of the stack.
+ *          - LFStack_Pop:     Removes the top character and optionally returns it.
+ *          - LFStack_Push:    Adds a character to the top of the stack.
+ *
+ * @code
+ * // Using example
+ * LFStack s;
+ * LFStack_Init(&s, 1024);
+ * // Any number of threads may now call the following concurrently
+ * if (LFStack_Push(&s, 'a')) {
+ *     char c;
+ *     if (LFStack_Pop(&s, &c)) {
+ *         // Use c
+ *     }
+ * }
+ * // After all threads have finished
+ * LFStack_Dispose(&s);
+ * @endcode
+ *
+ * @see c202-lockfree.h for type definitions.
+ *
+ * @see https://github.com/Jekwwer/IAL-Project01-2021 for the project repository.
+ */
+
+#include "c202-lockfree.h"
+#include <stdlib.h>
+
+/** Returns the index of the node referenced by a tagged word increased by one. */
+#define LF_INDEX(word) ((uint32_t) ((word) & 0xFFFFFFFFu))
+/** Builds a tagged word from the previous one and a new node index increased by one. */
+#define LF_NEXT_WORD(word, index) ((((word) >> 32) + 1) << 32 | (uint64_t) (index))
+
+/**
+ * @brief Detaches the first node of a tagged list.
+ *
+ * @details Reads the head word, follows the link of the referenced node and swings the
+ *          head to it. The link may be stale if the node is concurrently popped and
+ *          reused, but then the tag of the head has changed and the swap is retried.
+ *
+ * @param head The head word of the stack or of the free list.
+ * @param nodes The node array of the stack.
+ *
+ * @retval uint32_t Index of the detached node increased by one, or zero if the list
+ *                  was empty.
+ */
+static uint32_t LFStack_Detach(_Atomic uint64_t *head, LFStackNode *nodes) {
+
+    uint64_t word = atomic_load_explicit(head, memory_order_acquire);
+    uint64_t newWord;
+    uint32_t index;
+
+    do {
+        index = LF_INDEX(word);
+        if (index == 0) {
+            return 0;
+        }
+        uint32_t next = atomic_load_explicit(&nodes[index - 1].next, memory_order_relaxed);
+        newWord = LF_NEXT_WORD(word, next);
+    } while (!atomic_compare_exchange_weak_explicit(head, &word, newWord,
+                                                    memory_order_acquire,
+                                                    memory_order_acquire));
+
+    return index;
+}
+
+/**
+ * @brief Attaches a node in front of a tagged list.
+ *
+ * @details Links the node to the current head and publishes it with a release swap, so
+ *          a thread that detaches the node afterwards also sees its data.
+ *
+ * @param head The head word of the stack or of the free list.
+ * @param nodes The node array of the stack.
+ * @param index Index of the node to attach increased by one.
+ */
+static void LFStack_Attach(_Atomic uint64_t *head, LFStackNode *nodes, uint32_t index) {
+
+    uint64_t word = atomic_load_explicit(head, memory_order_relaxed);
+
+    do {
+        atomic_store_explicit(&nodes[index - 1].next, LF_INDEX(word), memory_order_relaxed);
+    } while (!atomic_compare_exchange_weak_explicit(head, &word, LF_NEXT_WORD(word, index),
+                                                    memory_order_release,
+                                                    memory_order_relaxed));
+}
+
+/**
+ * @brief Initializes an empty lock-free stack with the given capacity.
+ *
+ * @details Allocates 'capacity' nodes and links all of them into the free list. This is
+ *          the only allocation the stack ever performs.
+ *
+ * @param stack Pointer to the stack structure to be initialized.
+ * @param capacity Maximum number of characters the stack can hold.
+ *
+ * @pre No other thread may use the stack during the initialization.
+ *
+ * @post The stack is empty. If 'stack' is NULL or the nodes cannot be allocated,
+ *       Stack_Error is called with SERR_INIT and the stack has no capacity.
+ *
+ * @return This function does not return a value.
+ */
+void LFStack_Init(LFStack *stack, int capacity) {
+
+    if (stack == NULL) {
+        Stack_Error(SERR_INIT);
+        return;
+    }
+
+    stack->nodes = capacity > 0 ? (LFStackNode *) malloc(sizeof(LFStackNode) * capacity) : NULL;
+    stack->capacity = stack->nodes == NULL ? 0 : capacity;
+    atomic_init(&stack->top, 0);
+    atomic_init(&stack->freeList, 0);
+
+    if (stack->nodes == NULL) {
+        Stack_Error(SERR_INIT);
+        return;
+    }
+
+    // Node i links to node i + 1, indices are stored increased by one
+    for (int i = 0; i < capacity; i++) {
+        atomic_init(&stack->nodes[i].data, '\0');
+        atomic_init(&stack->nodes[i].next, i + 1 < capacity ? (uint32_t) i + 2 : 0);
+    }
+    atomic_init(&stack->freeList, 1);
+}
+
+/**
+ * @brief Releases the nodes of the stack.
+ *
+ * @param stack Pointer to the initialized stack structure.
+ *
+ * @pre No other thread may use the stack anymore.
+ *
+ * @post The stack is empty and has no capacity. It has to be initialized again before
+ *       it can be used.
+ *
+ * @return This function does not return a value.
+ */
+void LFStack_Dispose(LFStack *stack) {
+
+    free(stack->nodes);
+    stack->nodes = NULL;
+    stack->capacity = 0;
+    atomic_store(&stack->top, 0);
+    atomic_store(&stack->freeList, 0);
+}
+
+/**
+ * @brief Determines if the stack is empty.
+ *
+ * @param stack Pointer to the initialized stack structure.
+ *
+ * @note The result is a snapshot; another thread may change the stack right after it
+ *       has been taken.
+ *
+ * @retval int Returns a non-zero value if the stack is empty, otherwise returns zero.
+ */
+int LFStack_IsEmpty(LFStack *stack) {
+
+    return LF_INDEX(atomic_load_explicit(&stack->top, memory_order_acquire)) == 0;
+}
+
+/**
+ * @brief Reads the character on the top of the stack without removing it.
+ *
+ * @param stack Pointer to the initialized stack structure.
+ * @param dataPtr Pointer to the destination variable for the character.
+ *
+ * @note The character is a snapshot of the top at the time of the call.
+ *
+ * @retval int Returns TRUE if a character was read, or FALSE if the stack was empty and
+ *             the destination variable was left untouched.
+ */
+int LFStack_Top(LFStack *stack, char *dataPtr) {
+
+    uint32_t index = LF_INDEX(atomic_load_explicit(&stack->top, memory_order_acquire));
+    if (index == 0) {
+        return FALSE;
+    }
+
+    *dataPtr = atomic_load_explicit(&stack->nodes[index - 1].data, memory_order_relaxed);
+    return TRUE;
+}
+
+/**
+ * @brief Removes the character on the top of the stack.
+ *
+ * @details Reading and removing the top is a single atomic step, unlike the Stack_Top
+ *          and Stack_Pop pair of the c202 stack. The freed node goes to the free list.
+ *
+ * @param stack Pointer to the initialized stack structure.
+ * @param dataPtr Pointer to the destination variable for the removed character, or NULL
+ *                if the character is not needed.
+ *
+ * @retval int Returns TRUE if a character was removed, or FALSE if the stack was empty.
+ */
+int LFStack_Pop(LFStack *stack, char *dataPtr) {
+
+    uint32_t index = LFStack_Detach(&stack->top, stack->nodes);
+    if (index == 0) {
+        return FALSE;
+    }
+
+    if (dataPtr != NULL) {
+        *dataPtr = atomic_load_explicit(&stack->nodes[index - 1].data, memory_order_relaxed);
+    }
+    LFStack_Attach(&stack->freeList, stack->nodes, index);
+    return TRUE;
+}
+
+/**
+ * @brief Inserts a character on top of the stack.
+ *
+ * @details Takes a node from the free list, stores the character into it and publishes
+ *          it on the top of the stack.
+ *
+ * @param stack Pointer to the initialized stack structure.
+ * @param data The character to insert onto the stack.
+ *
+ * @retval int Returns TRUE if the character was inserted, or FALSE if all nodes are in
+ *             use and the stack is full.
+ */
+int LFStack_Push(LFStack *stack, char data) {
+
+    uint32_t index = LFStack_Detach(&stack->freeList, stack->nodes);
+    if (index == 0) {
+        return FALSE;
+    }
+
+    atomic_store_explicit(&stack->nodes[index - 1].data, data, memory_order_relaxed);
+    LFStack_Attach(&stack->top, stack->nodes, index);
+    return TRUE;
+}
+
+/* End of c202-lockfree.c */
@@ -0,0 +1,67 @@
+/**
+ * @file c202-lockfree.h
+ * @brief Lock-free character stack shared between threads.
+ * @details Declares a Treiber stack whose nodes live in one array allocated by
+ *          LFStack_Init. Links are 32-bit node indices, which leaves room for a 32-bit
+ *          modification tag next to the index in a single 64-bit word. Every successful
+ *          compare-and-swap on the top of the stack bumps the tag, so a thread that read
+ *          the top before another thread popped and pushed the same node back fails its
+ *          swap instead of corrupting the stack (ABA protection).
+ *
+ *          Unused nodes are kept in a second Treiber stack (the free list), so the stack
+ *          never calls malloc or free after its initialization and a node is never
+ *          returned to the system while another thread may still be reading it.
+ *
+ * @note Unlike the c202 stack, Push, Pop and Top report their outcome through the return
+ *       value. Checking Stack_IsEmpty or Stack_IsFull first and acting afterwards is a
+ *       race when other threads use the same stack, and the global error_flag used by
+ *       Stack_Error is not thread-safe.
+ *
+ * @see c202.h for the single-threaded stack this one mirrors.
+ *
+ * @see https://github.com/Jekwwer/IAL-Project01-2021 for the project repository.
+ */
+
+#ifndef _STACK_LOCKFREE_H_
+#define _STACK_LOCKFREE_H_
+
+#include <stdatomic.h>
+#include <stdint.h>
+
+#include "c202.h"
+
+/** Node of the lock-free stack. */
+typedef struct {
+	/** Stored character, atomic because Top may read a node that is being reused. */
+	_Atomic char data;
+	/** Index of the next node increased by one, zero marks the end of the stack. */
+	_Atomic uint32_t next;
+} LFStackNode;
+
+/** Lock-free stack with a fixed capacity. */
+typedef struct {
+	/** Array holding all nodes of the stack. */
+	LFStackNode *nodes;
+	/** Number of nodes in the array. */
+	int capacity;
+	/** Modification tag in the upper half, index of the top node plus one in the lower half. */
+	_Atomic uint64_t top;
+	/** Top of the free list, in the same format as 'top'. */
+	_Atomic uint64_t freeList;
+} LFStack;
+
+void LFStack_Init( LFStack *, int );
+
+void LFStack_Dispose( LFStack * );
+
+int LFStack_IsEmpty( LFStack * );
+
+int LFStack_Top( LFStack *, char * );
+
+int LFStack_Pop( LFStack *, char * );
+
+int LFStack_Push( LFStack *, char );
+
+#endif
+
+/* End of c202-lockfree.h */
@@ -9,7 +9,12 @@
 /* Basic tests for c202.c */
 
 #include "c202.h"
+#include "c202-bulk.h"
+#include "c202-generic.h"
+#include "c202-lockfree.h"
+#include "c202-wsdeque.h"
 
+#include <pthread.h>
 #include <stdio.h>
 #include <stdlib.h>
 
@@ -96,6 +101,65 @@ void use_stack_push( Stack *stack, char c ) {
 		printf("[W] Function Stack_Push was not implemented.\n");
 }
 
+/** Typed stacks generated by c202-generic.h. */
+STACK_DEFINE(IntStack, int, 4)
+STACK_DEFINE_DYNAMIC(DoubleStack, double)
+
+/** Number of threads sharing the lock-free stack in the tests. */
+#define LFSTACK_THREADS 4
+/** Number of push/pop pairs performed by every thread. */
+#define LFSTACK_ROUNDS 100000
+
+LFStack lfStack;
+
+/** Pushes and pops characters on the shared lock-free stack, counts the failures. */
+void *lfstack_worker( void *arg ) {
+	int *failures = arg;
+	for (int i = 0; i < LFSTACK_ROUNDS; i++)
+	{
+		char c;
+		if (!LFStack_Push(&lfStack, 'a' + i % 26))
+			(*failures)++;
+		if (!LFStack_Pop(&lfStack, &c))
+			(*failures)++;
+	}
+	return NULL;
+}
+
+/** Range of numbers summed by a task of the scheduler test. */
+typedef struct {
+	long from;
+	long to;
+	WSTask task;
+} SumRange;
+
+_Atomic long rangeSum;
+
+/** Sums a range directly when it is short, otherwise spawns a task for its upper half. */
+void sum_range_task( WSWorker *worker, void *arg ) {
+	SumRange *range = arg;
+	while (range->to - range->from > 64)
+	{
+		long middle = (range->from + range->to) / 2;
+		SumRange *upper = malloc(sizeof(SumRange));
+		*upper = (SumRange) {middle, range->to, {sum_range_task, upper}};
+		upper->task.arg = upper;
+		range->to = middle;
+		if (!WSScheduler_Spawn(worker, &upper->task))
+		{
+			// Not queued, sum the upper half here as well
+			range->to = upper->to;
+			free(upper);
+			break;
+		}
+	}
+	long sum = 0;
+	for (long i = range->from; i < range->to; i++)
+		sum += i;
+	atomic_fetch_add(&rangeSum, sum);
+	free(range);
+}
+
 /****************************************************************************** 
  * Actual testing                                                             *
  ******************************************************************************/
@@ -158,6 +222,137 @@ int main() {
 	use_stack_empty(stack);
 	use_stack_full(stack);
 
+	printf("\n[TEST10] Bulk operations from c202-bulk.h\n");
+	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+	use_stack_init(stack);
+	Stack_PushN(stack, "ABCDE", 5);
+	stackPrint(stack);
+	printf("Stack_FindFromTop for 'B' returned %d\n", Stack_FindFromTop(stack, 'B'));
+	printf("Stack_FindFromTop for '?' returned %d\n", Stack_FindFromTop(stack, '?'));
+	char block[4] = "";
+	Stack_PeekN(stack, block, 3);
+	printf("Stack_PeekN returned '%s'\n", block);
+	Stack_PopN(stack, 2);
+	stackPrint(stack);
+	Stack_PushN(stack, "vwxyz", 5);
+	use_stack_full(stack);
+	Stack_PushN(stack, "!", 1);
+	Stack_PeekN(stack, block, 9);
+	Stack_PopN(stack, 42);
+	use_stack_empty(stack);
+
+	printf("\n[TEST11] Fixed capacity int stack from c202-generic.h\n");
+	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+	IntStack intStack;
+	IntStack_Init(&intStack);
+	for (int i = 1; !IntStack_IsFull(&intStack); i++)
+		IntStack_Push(&intStack, i * 100);
+	error_flag = 0;
+	IntStack_Push(&intStack, 500);
+	printf("IntStack_Push on a full stack %s an error\n", error_flag ? "reported" : "did not report");
+	while (!IntStack_IsEmpty(&intStack))
+	{
+		int top;
+		IntStack_Top(&intStack, &top);
+		IntStack_Pop(&intStack);
+		printf("IntStack_Top returned %d\n", top);
+	}
+
+	printf("\n[TEST12] Growable double stack from c202-generic.h\n");
+	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+	DoubleStack doubleStack;
+	DoubleStack_Init(&doubleStack, 1);
+	for (int i = 0; i < 10 && !DoubleStack_IsFull(&doubleStack); i++)
+		DoubleStack_Push(&doubleStack, i / 4.0);
+	printf("DoubleStack holds %d items with capacity %d\n", doubleStack.topIndex + 1, doubleStack.capacity);
+	double topValue;
+	DoubleStack_Top(&doubleStack, &topValue);
+	printf("DoubleStack_Top returned %.2f\n", topValue);
+	DoubleStack_Dispose(&doubleStack);
+	// A stack whose capacity cannot double any more is full and refuses to push
+	doubleStack = (DoubleStack) { NULL, INT_MAX / 2, INT_MAX / 2 + 1 };
+	printf("DoubleStack_IsFull at the largest capacity returned '%s'\n",
+		DoubleStack_IsFull(&doubleStack) ? "TRUE" : "FALSE");
+	DoubleStack_Push(&doubleStack, 1.0);
+	printf("DoubleStack holds %d items after a push onto it\n", doubleStack.topIndex + 1);
+
+	printf("\n[TEST13] Lock-free stack used by a single thread\n");
+	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+	LFStack_Init(&lfStack, 3);
+	printf("LFStack_IsEmpty returned '%s'\n", LFStack_IsEmpty(&lfStack) ? "TRUE" : "FALSE");
+	for (char c = 'X'; c <= 'Z'; c++)
+		LFStack_Push(&lfStack, c);
+	printf("LFStack_Push on a full stack returned '%s'\n", LFStack_Push(&lfStack, '!') ? "TRUE" : "FALSE");
+	char lfTop;
+	LFStack_Top(&lfStack, &lfTop);
+	printf("LFStack_Top returned '%c'\n", lfTop);
+	while (LFStack_Pop(&lfStack, &lfTop))
+		printf("LFStack_Pop returned '%c'\n", lfTop);
+	printf("LFStack_Top on an empty stack returned '%s'\n", LFStack_Top(&lfStack, &lfTop) ? "TRUE" : "FALSE");
+	LFStack_Dispose(&lfStack);
+
+	printf("\n[TEST14] Lock-free stack shared by %d threads\n", LFSTACK_THREADS);
+	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+	LFStack_Init(&lfStack, LFSTACK_THREADS);
+	pthread_t threads[LFSTACK_THREADS];
+	int failures[LFSTACK_THREADS] = {0};
+	for (int i = 0; i < LFSTACK_THREADS; i++)
+		pthread_create(&threads[i], NULL, lfstack_worker, &failures[i]);
+	int totalFailures = 0;
+	for (int i = 0; i < LFSTACK_THREADS; i++)
+	{
+		pthread_join(threads[i], NULL);
+		totalFailures += failures[i];
+	}
+	printf("Failed operations: %d\n", totalFailures);
+	printf("LFStack_IsEmpty returned '%s'\n", LFStack_IsEmpty(&lfStack) ? "TRUE" : "FALSE");
+	int lfCount = 0;
+	while (LFStack_Push(&lfStack, 'a'))
+		lfCount++;
+	printf("Nodes returned to the free list: %d\n", lfCount);
+	LFStack_Dispose(&lfStack);
+
+	printf("\n[TEST15] Work-stealing deque used by its owner and a thief\n");
+	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+	WSDeque deque;
+	WSDeque_Init(&deque, 2);
+	char items[] = "ABCDEFGH";
+	int pushed = 0;
+	for (int i = 0; i < 8; i++)
+		pushed += WSDeque_PushTop(&deque, &items[i]);
+	printf("WSDeque_PushTop inserted %d items into a deque of capacity 2\n", pushed);
+	void *item;
+	WSDeque_StealBottom(&deque, &item);
+	printf("WSDeque_StealBottom returned '%c'\n", *(char *) item);
+	WSDeque_PopTop(&deque, &item);
+	printf("WSDeque_PopTop returned '%c'\n", *(char *) item);
+	printf("Remaining items from the top:");
+	while (WSDeque_PopTop(&deque, &item))
+		printf(" %c", *(char *) item);
+	printf("\nWSDeque_IsEmpty returned '%s'\n", WSDeque_IsEmpty(&deque) ? "TRUE" : "FALSE");
+	WSDeque_Dispose(&deque);
+	// A disposed deque has no array, like one whose initialization failed
+	printf("WSDeque_PushTop on a deque without an array returned '%s'\n",
+		WSDeque_PushTop(&deque, &items[0]) ? "TRUE" : "FALSE");
+
+	printf("\n[TEST16] Scheduler summing numbers from 0 to 99999 with spawned tasks\n");
+	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+	WSScheduler scheduler;
+	printf("WSScheduler_Init returned '%s'\n", WSScheduler_Init(&scheduler, 4) ? "TRUE" : "FALSE");
+	for (long i = 0; i < 100000; i += 25000)
+	{
+		SumRange *range = malloc(sizeof(SumRange));
+		*range = (SumRange) {i, i + 25000, {sum_range_task, NULL}};
+		range->task.arg = range;
+		WSScheduler_Submit(&scheduler, &range->task);
+	}
+	WSScheduler_Run(&scheduler);
+	printf("Sum computed by the scheduler: %ld\n", atomic_load(&rangeSum));
+	WSScheduler_Dispose(&scheduler);
+	SumRange refused = {0, 1, {sum_range_task, &refused}};
+	printf("WSScheduler_Submit to a scheduler without workers returned '%s'\n",
+		WSScheduler_Submit(&scheduler, &refused.task) ? "TRUE" : "FALSE");
+
 	printf("\n\n----- C202 - The End of Basic Tests -----\n");
 
 	free(stack);
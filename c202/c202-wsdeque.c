@@ -0,0 +1,477 @@
+/**
+ * @file c202-wsdeque.c
+ * @brief Chase-Lev work-stealing deque and scheduler implementation file.
+ * @details Implements the deque and the scheduler declared in c202-wsdeque.h. The deque
+ *          follows the C11 formulation of the Chase-Lev algorithm by Lê, Pop, Cohen and
+ *          Zappa Nardelli (2013), with the owner end called the top to match the stack.
+ *
+ *          The functions implemented are:
+ *          - WSDeque_Init:         Initializes an empty deque with a given capacity.
+ *          - WSDeque_Dispose:      Releases the current and all retired arrays.
+ *          - WSDeque_IsEmpty:      Checks if the deque is empty.
+ *          - WSDeque_PushTop:      Owner inserts an item on the top, growing the array.
+ *          - WSDeque_PopTop:       Owner removes the newest item from the top.
+ *          - WSDeque_StealBottom:  Any thread removes the oldest item from the bottom.
+ *          - WSScheduler_Init:     Creates the workers and their deques.
+ *          - WSScheduler_Dispose:  Releases the workers.
+ *          - WSScheduler_Submit:   Queues a task before the scheduler is run.
+ *          - WSScheduler_Spawn:    Queues a task from within a running task.
+ *          - WSScheduler_Run:      Executes all tasks and returns once they have finished.
+ *
+ * @code
+ * // Using example
+ * void convert(WSWorker *worker, void *arg) {
+ *     (void) worker;
+ *     char **expression = arg;
+ *     *expression = infix2postfix(*expression);
+ * }
+ *
+ * WSScheduler scheduler;
+ * WSScheduler_Init(&scheduler, 4);
+ * for (int i = 0; i < count; i++) {
+ *     tasks[i] = (WSTask) {convert, &expressions[i]};
+ *     WSScheduler_Submit(&scheduler, &tasks[i]);
+ * }
+ * WSScheduler_Run(&scheduler);
+ * WSScheduler_Dispose(&scheduler);
+ * @endcode
+ *
+ * @see c202-wsdeque.h for type definitions.
+ *
+ * @see https://github.com/Jekwwer/IAL-Project01-2021 for the project repository.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "c202-wsdeque.h"
+#include <sched.h>
+#include <stdlib.h>
+
+/**
+ * @brief Allocates a circular array with the given number of slots.
+ *
+ * @param size Number of slots, a power of two.
+ *
+ * @retval WSDequeArray* The new array, or NULL if the allocation failed.
+ */
+static WSDequeArray *WSDeque_NewArray(int64_t size) {
+
+    WSDequeArray *array = malloc(sizeof(WSDequeArray) + sizeof(_Atomic(void *)) * size);
+    if (array != NULL) {
+        array->size = size;
+        array->retired = NULL;
+    }
+    return array;
+}
+
+/**
+ * @brief Initializes an empty deque.
+ *
+ * @param deque Pointer to the deque structure to be initialized.
+ * @param capacity Initial capacity, rounded up to a power of two.
+ *
+ * @pre No other thread may use the deque during the initialization.
+ *
+ * @post The deque is empty. If the array cannot be allocated, Stack_Error is called with
+ *       SERR_INIT and the deque has no array; WSDeque_PushTop then refuses every item.
+ *
+ * @retval int Returns TRUE if the deque was initialized, or FALSE if its array could not
+ *             be allocated.
+ */
+int WSDeque_Init(WSDeque *deque, int capacity) {
+
+    int64_t size = 1;
+    while (size < capacity) {
+        size *= 2;
+    }
+
+    atomic_init(&deque->topIndex, 0);
+    atomic_init(&deque->bottomIndex, 0);
+    atomic_init(&deque->array, WSDeque_NewArray(size));
+
+    if (atomic_load_explicit(&deque->array, memory_order_relaxed) == NULL) {
+        Stack_Error(SERR_INIT);
+        return FALSE;
+    }
+    return TRUE;
+}
+
+/**
+ * @brief Releases the current array of the deque and all arrays it replaced.
+ *
+ * @param deque Pointer to the initialized deque structure.
+ *
+ * @pre No other thread may use the deque anymore.
+ *
+ * @return This function does not return a value.
+ */
+void WSDeque_Dispose(WSDeque *deque) {
+
+    WSDequeArray *array = atomic_load_explicit(&deque->array, memory_order_relaxed);
+    while (array != NULL) {
+        WSDequeArray *retired = array->retired;
+        free(array);
+        array = retired;
+    }
+    atomic_store_explicit(&deque->array, NULL, memory_order_relaxed);
+}
+
+/**
+ * @brief Determines if the deque is empty.
+ *
+ * @param deque Pointer to the initialized deque structure.
+ *
+ * @note The result is a snapshot when thieves are active.
+ *
+ * @retval int Returns a non-zero value if the deque is empty, otherwise returns zero.
+ */
+int WSDeque_IsEmpty(WSDeque *deque) {
+
+    int64_t top = atomic_load_explicit(&deque->topIndex, memory_order_acquire);
+    int64_t bottom = atomic_load_explicit(&deque->bottomIndex, memory_order_acquire);
+    return bottom >= top;
+}
+
+/**
+ * @brief Inserts an item on the top of the deque.
+ *
+ * @details If the circular array is full, its live part is copied into an array of
+ *          twice the size which is then published to thieves. The old array is linked
+ *          from the new one and released together with the deque.
+ *
+ * @param deque Pointer to the initialized deque structure.
+ * @param item The item to insert.
+ *
+ * @pre Only the owner of the deque may call this function.
+ *
+ * @post The item is the newest one in the deque. If the deque has no array or the array
+ *       cannot grow, Stack_Error is called with SERR_PUSH and the deque is not changed.
+ *
+ * @retval int Returns TRUE if the item was inserted, or FALSE if the deque has no array
+ *             or the array could not grow.
+ */
+int WSDeque_PushTop(WSDeque *deque, void *item) {
+
+    int64_t top = atomic_load_explicit(&deque->topIndex, memory_order_relaxed);
+    int64_t bottom = atomic_load_explicit(&deque->bottomIndex, memory_order_acquire);
+    WSDequeArray *array = atomic_load_explicit(&deque->array, memory_order_relaxed);
+
+    if (array == NULL) {
+        Stack_Error(SERR_PUSH);
+        return FALSE;
+    }
+
+    if (top - bottom > array->size - 1) {
+        WSDequeArray *grown = WSDeque_NewArray(array->size * 2);
+        if (grown == NULL) {
+            Stack_Error(SERR_PUSH);
+            return FALSE;
+        }
+        for (int64_t i = bottom; i < top; i++) {
+            void *moved = atomic_load_explicit(&array->slots[i & (array->size - 1)], memory_order_relaxed);
+            atomic_store_explicit(&grown->slots[i & (grown->size - 1)], moved, memory_order_relaxed);
+        }
+        grown->retired = array;
+        atomic_store_explicit(&deque->array, grown, memory_order_release);
+        array = grown;
+    }
+
+    atomic_store_explicit(&array->slots[top & (array->size - 1)], item, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(&deque->topIndex, top + 1, memory_order_relaxed);
+    return TRUE;
+}
+
+/**
+ * @brief Removes the newest item from the top of the deque.
+ *
+ * @details Reserves the top slot first and only then looks at the bottom, so a thief
+ *          and the owner can compete for the last item. That race is decided by a
+ *          compare-and-swap on the bottom index.
+ *
+ * @param deque Pointer to the initialized deque structure.
+ * @param itemPtr Pointer to the destination variable for the removed item.
+ *
+ * @pre Only the owner of the deque may call this function.
+ *
+ * @retval int Returns TRUE if an item was removed, or FALSE if the deque was empty or
+ *             its last item was stolen.
+ */
+int WSDeque_PopTop(WSDeque *deque, void **itemPtr) {
+
+    int64_t top = atomic_load_explicit(&deque->topIndex, memory_order_relaxed) - 1;
+    WSDequeArray *array = atomic_load_explicit(&deque->array, memory_order_relaxed);
+    atomic_store_explicit(&deque->topIndex, top, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    int64_t bottom = atomic_load_explicit(&deque->bottomIndex, memory_order_relaxed);
+
+    if (bottom > top) {
+        // The deque was empty, restore the top index
+        atomic_store_explicit(&deque->topIndex, top + 1, memory_order_relaxed);
+        return FALSE;
+    }
+
+    *itemPtr = atomic_load_explicit(&array->slots[top & (array->size - 1)], memory_order_relaxed);
+    if (bottom == top) {
+        // The last item, thieves may be trying to take it as well
+        int won = atomic_compare_exchange_strong_explicit(&deque->bottomIndex, &bottom, bottom + 1,
+                                                          memory_order_seq_cst,
+                                                          memory_order_relaxed);
+        atomic_store_explicit(&deque->topIndex, top + 1, memory_order_relaxed);
+        return won;
+    }
+    return TRUE;
+}
+
+/**
+ * @brief Removes the oldest item from the bottom of the deque.
+ *
+ * @param deque Pointer to the initialized deque structure.
+ * @param itemPtr Pointer to the destination variable for the removed item.
+ *
+ * @note Any thread may call this function.
+ *
+ * @retval int Returns TRUE if an item was stolen, or FALSE if the deque was empty or
+ *             another thread took the item first. In the latter case the caller may
+ *             simply try again.
+ */
+int WSDeque_StealBottom(WSDeque *deque, void **itemPtr) {
+
+    int64_t bottom = atomic_load_explicit(&deque->bottomIndex, memory_order_acquire);
+    atomic_thread_fence(memory_order_seq_cst);
+    int64_t top = atomic_load_explicit(&deque->topIndex, memory_order_acquire);
+
+    if (bottom >= top) {
+        return FALSE;
+    }
+
+    WSDequeArray *array = atomic_load_explicit(&deque->array, memory_order_acquire);
+    void *item = atomic_load_explicit(&array->slots[bottom & (array->size - 1)], memory_order_relaxed);
+    if (!atomic_compare_exchange_strong_explicit(&deque->bottomIndex, &bottom, bottom + 1,
+                                                 memory_order_seq_cst,
+                                                 memory_order_relaxed)) {
+        return FALSE;
+    }
+
+    *itemPtr = item;
+    return TRUE;
+}
+
+/**
+ * @brief Initializes a scheduler with the given number of workers.
+ *
+ * @param scheduler Pointer to the scheduler structure to be initialized.
+ * @param workerCount Number of worker threads used by WSScheduler_Run, at least one.
+ *
+ * @post The scheduler has no tasks. If the workers or their deques cannot be allocated,
+ *       Stack_Error is called with SERR_INIT, everything allocated so far is released
+ *       and the scheduler has no workers, so it refuses every task.
+ *
+ * @retval int Returns TRUE if the scheduler was initialized, otherwise FALSE.
+ */
+int WSScheduler_Init(WSScheduler *scheduler, int workerCount) {
+
+    if (workerCount < 1) {
+        workerCount = 1;
+    }
+
+    scheduler->workers = malloc(sizeof(WSWorker) * workerCount);
+    scheduler->workerCount = scheduler->workers == NULL ? 0 : workerCount;
+    scheduler->nextWorker = 0;
+    atomic_init(&scheduler->pending, 0);
+
+    if (scheduler->workers == NULL) {
+        Stack_Error(SERR_INIT);
+        return FALSE;
+    }
+
+    for (int i = 0; i < workerCount; i++) {
+        scheduler->workers[i].scheduler = scheduler;
+        scheduler->workers[i].id = i;
+        scheduler->workers[i].seed = 2654435761u * (i + 1);
+        if (!WSDeque_Init(&scheduler->workers[i].deque, MAX_STACK)) {
+            // Unwind the deques initialized so far, WSDeque_Init reported the error
+            while (--i >= 0) {
+                WSDeque_Dispose(&scheduler->workers[i].deque);
+            }
+            free(scheduler->workers);
+            scheduler->workers = NULL;
+            scheduler->workerCount = 0;
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+/**
+ * @brief Releases the workers of the scheduler.
+ *
+ * @param scheduler Pointer to the initialized scheduler structure.
+ *
+ * @pre The scheduler must not be running.
+ *
+ * @return This function does not return a value.
+ */
+void WSScheduler_Dispose(WSScheduler *scheduler) {
+
+    for (int i = 0; i < scheduler->workerCount; i++) {
+        WSDeque_Dispose(&scheduler->workers[i].deque);
+    }
+    free(scheduler->workers);
+    scheduler->workers = NULL;
+    scheduler->workerCount = 0;
+}
+
+/**
+ * @brief Queues a task before the scheduler is run.
+ *
+ * @details Tasks are dealt to the workers in a round-robin fashion.
+ *
+ * @param scheduler Pointer to the initialized scheduler structure.
+ * @param task The task to execute. It must stay valid until it has been executed.
+ *
+ * @pre The scheduler must not be running. Use WSScheduler_Spawn from within tasks.
+ *
+ * @retval int Returns TRUE if the task was queued, or FALSE if the scheduler has no
+ *             workers or the deque of the worker could not grow; the task is then not
+ *             counted and will not be executed.
+ */
+int WSScheduler_Submit(WSScheduler *scheduler, WSTask *task) {
+
+    if (scheduler->workerCount == 0) {
+        Stack_Error(SERR_PUSH);
+        return FALSE;
+    }
+
+    WSWorker *worker = &scheduler->workers[scheduler->nextWorker];
+    scheduler->nextWorker = (scheduler->nextWorker + 1) % scheduler->workerCount;
+
+    atomic_fetch_add_explicit(&scheduler->pending, 1, memory_order_relaxed);
+    if (!WSDeque_PushTop(&worker->deque, task)) {
+        atomic_fetch_sub_explicit(&scheduler->pending, 1, memory_order_relaxed);
+        return FALSE;
+    }
+    return TRUE;
+}
+
+/**
+ * @brief Queues a task from within a running task.
+ *
+ * @details The task is pushed on the top of the executing worker's deque, so that the
+ *          worker picks it up next unless another worker steals it first.
+ *
+ * @param worker The worker passed to the currently executing task.
+ * @param task The task to execute. It must stay valid until it has been executed.
+ *
+ * @retval int Returns TRUE if the task was queued, or FALSE if the deque of the worker
+ *             could not grow; the calling task should then do the work itself.
+ */
+int WSScheduler_Spawn(WSWorker *worker, WSTask *task) {
+
+    // Counted before the push so a thief cannot finish the task before it is counted;
+    // the parent is still pending, so taking the count back cannot end the run
+    atomic_fetch_add_explicit(&worker->scheduler->pending, 1, memory_order_relaxed);
+    if (!WSDeque_PushTop(&worker->deque, task)) {
+        atomic_fetch_sub_explicit(&worker->scheduler->pending, 1, memory_order_relaxed);
+        return FALSE;
+    }
+    return TRUE;
+}
+
+/**
+ * @brief Tries to steal a task from a randomly chosen worker.
+ *
+ * @param worker The worker looking for work.
+ * @param taskPtr Pointer to the destination variable for the stolen task.
+ *
+ * @retval int Returns TRUE if a task was stolen, otherwise FALSE.
+ */
+static int WSScheduler_Steal(WSWorker *worker, WSTask **taskPtr) {
+
+    WSScheduler *scheduler = worker->scheduler;
+    if (scheduler->workerCount < 2) {
+        return FALSE;
+    }
+
+    // Xorshift keeps victim selection free of shared state
+    worker->seed ^= worker->seed << 13;
+    worker->seed ^= worker->seed >> 17;
+    worker->seed ^= worker->seed << 5;
+    int victim = (int) (worker->seed % (unsigned) (scheduler->workerCount - 1));
+    if (victim >= worker->id) {
+        victim++;
+    }
+
+    void *item;
+    if (WSDeque_StealBottom(&scheduler->workers[victim].deque, &item)) {
+        *taskPtr = item;
+        return TRUE;
+    }
+    return FALSE;
+}
+
+/**
+ * @brief Main loop of a worker thread.
+ *
+ * @details Runs tasks from the worker's own deque and steals when it is empty, until
+ *          no task of the scheduler is pending.
+ *
+ * @param arg The worker.
+ *
+ * @retval void* Always NULL.
+ */
+static void *WSScheduler_WorkerLoop(void *arg) {
+
+    WSWorker *worker = arg;
+    WSScheduler *scheduler = worker->scheduler;
+
+    while (atomic_load_explicit(&scheduler->pending, memory_order_acquire) > 0) {
+        void *item;
+        WSTask *task;
+        if (WSDeque_PopTop(&worker->deque, &item)) {
+            task = item;
+        } else if (!WSScheduler_Steal(worker, &task)) {
+            sched_yield();
+            continue;
+        }
+
+        task->function(worker, task->arg);
+        atomic_fetch_sub_explicit(&scheduler->pending, 1, memory_order_release);
+    }
+    return NULL;
+}
+
+/**
+ * @brief Executes all queued tasks and the tasks they spawn.
+ *
+ * @details Starts one thread per worker except the first, whose loop runs on the
+ *          calling thread, and returns after every task has finished.
+ *
+ * @param scheduler Pointer to the initialized scheduler structure.
+ *
+ * @post No task is pending and the scheduler can be used for another batch. Workers for
+ *       which a thread cannot be started leave their tasks to be stolen by the others.
+ *
+ * @return This function does not return a value.
+ */
+void WSScheduler_Run(WSScheduler *scheduler) {
+
+    if (scheduler->workerCount == 0) {
+        return;
+    }
+
+    int started[scheduler->workerCount];
+
+    for (int i = 1; i < scheduler->workerCount; i++) {
+        started[i] = pthread_create(&scheduler->workers[i].thread, NULL,
+                                    WSScheduler_WorkerLoop, &scheduler->workers[i]) == 0;
+    }
+    WSScheduler_WorkerLoop(&scheduler->workers[0]);
+    for (int i = 1; i < scheduler->workerCount; i++) {
+        if (started[i]) {
+            pthread_join(scheduler->workers[i].thread, NULL);
+        }
+    }
+}
+
+/* End of c202-wsdeque.c */
@@ -0,0 +1,113 @@
+/**
+ * @file c202-wsdeque.h
+ * @brief Chase-Lev work-stealing deque and a small scheduler built on it.
+ * @details The deque is the c202 array stack turned into a per-worker task queue. Its
+ *          owner pushes and pops tasks at the top exactly like on a stack, while other
+ *          workers (thieves) steal the oldest tasks from the bottom. The array is
+ *          circular and doubles when it is full; replaced arrays are kept until the
+ *          deque is disposed of, because a thief may still be reading from them.
+ *
+ *          The scheduler owns one deque per worker thread. Tasks are distributed among
+ *          the deques before the run, and a running task may spawn further tasks into the
+ *          deque of the worker executing it. Idle workers steal from random victims.
+ *
+ * @note Only the owner of a deque may call WSDeque_PushTop and WSDeque_PopTop. Any thread
+ *       may call WSDeque_StealBottom.
+ *
+ * @see c202.h for the stack the deque is derived from.
+ *
+ * @see https://github.com/Jekwwer/IAL-Project01-2021 for the project repository.
+ */
+
+#ifndef _STACK_WSDEQUE_H_
+#define _STACK_WSDEQUE_H_
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+
+#include "c202.h"
+
+/** Circular array of the deque, its size is always a power of two. */
+typedef struct WSDequeArray {
+	/** Number of slots in the array. */
+	int64_t size;
+	/** Previously used array, kept alive for thieves that may still read it. */
+	struct WSDequeArray *retired;
+	/** Stored items. */
+	_Atomic(void *) slots[];
+} WSDequeArray;
+
+/** Work-stealing deque of pointers. */
+typedef struct {
+	/** Index one past the newest item, only the owner moves it up. */
+	_Atomic int64_t topIndex;
+	/** Index of the oldest item, thieves and the owner move it up. */
+	_Atomic int64_t bottomIndex;
+	/** Current circular array. */
+	_Atomic(WSDequeArray *) array;
+} WSDeque;
+
+int WSDeque_Init( WSDeque *, int );
+
+void WSDeque_Dispose( WSDeque * );
+
+int WSDeque_IsEmpty( WSDeque * );
+
+int WSDeque_PushTop( WSDeque *, void * );
+
+int WSDeque_PopTop( WSDeque *, void ** );
+
+int WSDeque_StealBottom( WSDeque *, void ** );
+
+struct WSWorker;
+
+/** Unit of work executed by the scheduler. */
+typedef struct {
+	/** Function performing the work, receives the executing worker and 'arg'. */
+	void (*function)( struct WSWorker *, void * );
+	/** Argument passed to the function. */
+	void *arg;
+} WSTask;
+
+struct WSScheduler;
+
+/** Worker thread of the scheduler. */
+typedef struct WSWorker {
+	/** Scheduler the worker belongs to. */
+	struct WSScheduler *scheduler;
+	/** Tasks owned by the worker. */
+	WSDeque deque;
+	/** Index of the worker within the scheduler. */
+	int id;
+	/** State of the generator choosing steal victims. */
+	unsigned seed;
+	/** Thread executing the worker. */
+	pthread_t thread;
+} WSWorker;
+
+/** Scheduler running tasks on a fixed number of workers. */
+typedef struct WSScheduler {
+	/** Array of workers. */
+	WSWorker *workers;
+	/** Number of workers. */
+	int workerCount;
+	/** Worker receiving the next submitted task. */
+	int nextWorker;
+	/** Number of submitted or spawned tasks that have not finished yet. */
+	_Atomic long pending;
+} WSScheduler;
+
+int WSScheduler_Init( WSScheduler *, int );
+
+void WSScheduler_Dispose( WSScheduler * );
+
+int WSScheduler_Submit( WSScheduler *, WSTask * );
+
+int WSScheduler_Spawn( WSWorker *, WSTask * );
+
+void WSScheduler_Run( WSScheduler * );
+
+#endif
+
+/* End of c202-wsdeque.h */
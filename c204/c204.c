@@ -14,6 +14,7 @@
  *          code clarity:
  *          - untilLeftPar: Empties the stack up to the left parenthesis.
  *          - doOperation: Processes the operator in the converted expression.
+ *          - flushOperators: Moves a block of operators from the stack to the output.
  * 
  * @note The implementation depends on the stack operations defined in c202.
  * 
@@ -44,11 +45,48 @@
  */
 
 #include "c204.h"
+#include "../c202/c202-bulk.h"
 #include <string.h>
 
 int solved;
 
 
+/**
+ * @brief Moves a block of operators from the stack to the postfix expression.
+ * 
+ * @details Copies the 'count' topmost operators straight into the postfix expression
+ *          with Stack_PeekN, reverses them in place so they appear in the order in
+ *          which they would have been popped one by one, and then drops them from the
+ *          stack with a single Stack_PopN.
+ * 
+ * @param stack Pointer to the initialized stack structure.
+ * @param count Number of operators to move.
+ * @param postfixExpression Character string containing the resulting postfix expression.
+ * @param postfixExpressionLength Pointer to the current length of the resulting postfix expression.
+ * 
+ * @pre The stack must hold at least 'count' characters and the postfix expression must
+ *      have room for them.
+ * 
+ * @post The operators are removed from the stack and appended to the postfix expression.
+ * 
+ * @return This function does not return a value.
+ */
+void flushOperators(Stack *stack, int count, char *postfixExpression,
+                    unsigned *postfixExpressionLength) {
+
+    char *block = &postfixExpression[*postfixExpressionLength];
+    Stack_PeekN(stack, block, count);
+    Stack_PopN(stack, count);
+
+    // The block is in the stack order, the expression needs the pop order
+    for (int i = 0, j = count - 1; i < j; i++, j--) {
+        char c = block[i];
+        block[i] = block[j];
+        block[j] = c;
+    }
+    *postfixExpressionLength += count;
+}
+
 /**
  * @brief Empties the stack up to the left parenthesis and appends operators to postfix expression.
  * 
@@ -70,8 +108,8 @@ int solved;
  *       stack. The postfixExpression is extended with the operators removed from the stack.
  *       The postfixExpressionLength is updated to reflect the new length of the expression.
  * 
- * @note A helper variable of type char is declared and used to minimize the number of
- *       accesses to the stack structure.
+ * @note The parenthesis is located by Stack_FindFromTop, and the operators above it are
+ *       then moved by flushOperators in one block.
  * 
  * @warning If the stack does not contain a left parenthesis '(', the function will empty
  *          the stack completely, which may not be the intended behavior.
@@ -84,14 +122,10 @@ int solved;
 void untilLeftPar(Stack *stack, char *postfixExpression,
                   unsigned *postfixExpressionLength) {
 
-    char c = '\0';
-    // Until we get the left parenthesis from the top of the stack
-    while (Stack_Top(stack, &c), c != '(') {
-        // Add elements from the stack to the result
-        postfixExpression[*postfixExpressionLength] = c;
-        (*postfixExpressionLength)++;
-        Stack_Pop(stack);
-    };
+    // Add elements above the left parenthesis to the result at once
+    flushOperators(stack, Stack_FindFromTop(stack, '('), postfixExpression,
+                   postfixExpressionLength);
+    // Drop the parenthesis as well
     Stack_Pop(stack);
 }
 
@@ -117,7 +151,8 @@ void untilLeftPar(Stack *stack, char *postfixExpression,
  *       depending on the precedence. The postfixExpression is modified to include operators
  *       in their postfix order, and postfixExpressionLength is updated accordingly.
  * 
- * @note The function uses recursion to handle operators with lower or equal precedence.
+ * @note Operators with lower or equal precedence are flushed in a loop rather than by
+ *       recursion, so no call frame is spent per popped operator.
  * 
  * @warning The function assumes that the operator 'c' and the operators in the stack are
  *          from the set { '+', '-', '*', '/' }. Undefined behavior may occur if other
@@ -133,21 +168,20 @@ void doOperation(Stack *stack, char c, char *postfixExpression,
 
     char top;
 
-    // If the stack is empty
-    if (Stack_IsEmpty(stack) ||
-        // Or there's a left parenthesis at the top
-        (Stack_Top(stack, &top), top == '(') ||
-        // Or there's an operator with lower priority at the top
-        (strchr("+-", top) != NULL && strchr("/*", c) != NULL)) {
+    // While the stack is not empty
+    while (!Stack_IsEmpty(stack) &&
+           // And there's no left parenthesis at the top
+           (Stack_Top(stack, &top), top != '(') &&
+           // And there's no operator with lower priority at the top
+           !(strchr("+-", top) != NULL && strchr("/*", c) != NULL)) {
 
-        Stack_Push(stack, c);
-        // Otherwise insert the top of the stack into the resulting string and call the function again
-    } else {
+        // Insert the top of the stack into the resulting string
         postfixExpression[*postfixExpressionLength] = top;
         (*postfixExpressionLength)++;
         Stack_Pop(stack);
-        doOperation(stack, c, postfixExpression, postfixExpressionLength);
     }
+
+    Stack_Push(stack, c);
 }
 
 /**
@@ -165,8 +199,8 @@ void doOperation(Stack *stack, char c, char *postfixExpression,
  *      exceed MAX_LEN - 1 characters.
  * 
  * @post The returned string will contain the postfix expression equivalent of the
- *       provided infix expression. The stack used for conversion is properly freed
- *       before exiting the function.
+ *       provided infix expression. The stack used for conversion is a local variable,
+ *       so the only heap allocation per call is the returned string.
  * 
  * @note The function assumes the input is well-formed and does not perform validation.
  *       It uses helper functions untilLeftPar and doOperation for processing.
@@ -183,7 +217,9 @@ void doOperation(Stack *stack, char c, char *postfixExpression,
  */
 char *infix2postfix(const char *infixExpression) {
 
-    Stack *stack = (Stack *) malloc(sizeof(Stack));
+    // The stack lives in the caller's frame, only the result is allocated
+    Stack operatorStack;
+    Stack *stack = &operatorStack;
     Stack_Init(stack);
 
     // Allocate as much memory as the input string takes
@@ -221,13 +257,8 @@ char *infix2postfix(const char *infixExpression) {
 
         // Processing delimiter (equals sign)
         if (infixExpression[i] == '=') {
-            while (!Stack_IsEmpty(stack)) {
-                char c;
-                Stack_Top(stack, &c);
-                Stack_Pop(stack);
-                result[j] = c;
-                j++;
-            }
+            // No left parenthesis is left open, so this counts the whole stack
+            flushOperators(stack, Stack_FindFromTop(stack, '('), result, &j);
             result[j] = '=';
             j++;
             result[j] = '\0';
@@ -236,12 +267,6 @@ char *infix2postfix(const char *infixExpression) {
         i++;
     }
 
-    // Releasing the allocated stack
-    while (!Stack_IsEmpty(stack)) {
-        Stack_Pop(stack);
-    }
-    free(stack);
-
     return result;
 }
 
@@ -0,0 +1,987 @@
+/* **************************** c206-bench.c ******************************** */
+/*  Course: Algorithms (IAL) - FIT VUT in Brno                                */
+/*  Task: c206 - Doubly Linked Linear List                                    */
+/*  Throughput benchmarks for the lists of c206                               */
+/* ************************************************************************** */
+
+/* Benchmarks are not part of the tests, their output depends on the machine. */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "c206-ext.h"
+#include "c206-concurrent.h"
+#include "c206-rcu.h"
+#include "c206-parallel.h"
+#include "c206-file.h"
+#include "c206-persistent.h"
+#include "c206-compact.h"
+#include "c206-lru.h"
+#include "c206-generic.h"
+#include "c206-intrusive.h"
+#include "c206-small.h"
+#include "c206-reclaim.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/** Number of values inserted by every producer. */
+#define VALUES_PER_PRODUCER 500000
+/** Highest number of producers and of consumers to measure. */
+#define MAX_THREADS 4
+/** Number of values moved by one batched operation. */
+#define BATCH 64
+/** Number of elements of the read-mostly lists. */
+#define READ_LIST_LENGTH 1000
+/** Number of lookups performed by every reader. */
+#define LOOKUPS_PER_READER 20000
+
+/******************************************************************************
+ * Helper functions                                                           *
+ ******************************************************************************/
+
+/** Returns the current time in seconds. */
+double now( void ) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/** Workload of one pipeline run. */
+typedef struct {
+	/** Run by every producer thread. */
+	void *(*producer)( void * );
+	/** Run by every consumer thread. */
+	void *(*consumer)( void * );
+	/** Called after all producers have finished, may be NULL. */
+	void (*finish)( void );
+} Pipeline;
+
+/** Runs the producers and consumers of 'pipeline' and returns the elapsed time in seconds. */
+double run_pipeline( Pipeline pipeline, int producers, int consumers ) {
+	pthread_t producerIds[MAX_THREADS], consumerIds[MAX_THREADS];
+	double start = now();
+	for (int i = 0; i < consumers; i++)
+		pthread_create(&consumerIds[i], NULL, pipeline.consumer, NULL);
+	for (int i = 0; i < producers; i++)
+		pthread_create(&producerIds[i], NULL, pipeline.producer, NULL);
+	for (int i = 0; i < producers; i++)
+		pthread_join(producerIds[i], NULL);
+	if (pipeline.finish != NULL)
+		pipeline.finish();
+	for (int i = 0; i < consumers; i++)
+		pthread_join(consumerIds[i], NULL);
+	return now() - start;
+}
+
+/******************************************************************************
+ * Measured workloads                                                         *
+ ******************************************************************************/
+
+DLList mutexList;
+pthread_mutex_t mutexListLock = PTHREAD_MUTEX_INITIALIZER;
+/** Number of values the consumers of the mutex list still have to remove. */
+long mutexListRemaining;
+
+/** Inserts values into the c206 list guarded by a single mutex. */
+void *mutex_producer( void *arg ) {
+	(void) arg;
+	for (int i = 0; i < VALUES_PER_PRODUCER; i++)
+	{
+		pthread_mutex_lock(&mutexListLock);
+		DLL_InsertLast(&mutexList, i);
+		pthread_mutex_unlock(&mutexListLock);
+	}
+	return NULL;
+}
+
+/** Removes values from the mutex list, polling while it is empty. */
+void *mutex_consumer( void *arg ) {
+	(void) arg;
+	for (;;)
+	{
+		int value;
+		pthread_mutex_lock(&mutexListLock);
+		if (mutexListRemaining == 0)
+		{
+			pthread_mutex_unlock(&mutexListLock);
+			return NULL;
+		}
+		int taken = mutexList.firstElement != NULL;
+		if (taken)
+		{
+			DLL_GetFirst(&mutexList, &value);
+			DLL_DeleteFirst(&mutexList);
+			mutexListRemaining--;
+		}
+		pthread_mutex_unlock(&mutexListLock);
+		if (!taken)
+			sched_yield();
+	}
+}
+
+TSDLList queue;
+
+/** Inserts values into the thread-safe list one by one. */
+void *queue_producer( void *arg ) {
+	(void) arg;
+	for (int i = 0; i < VALUES_PER_PRODUCER; i++)
+		TSDLL_InsertLast(&queue, i);
+	return NULL;
+}
+
+/** Removes values from the thread-safe list one by one. */
+void *queue_consumer( void *arg ) {
+	(void) arg;
+	int value;
+	while (TSDLL_PopFirst(&queue, &value))
+		;
+	return NULL;
+}
+
+/** Inserts values into the thread-safe list in batches. */
+void *batch_producer( void *arg ) {
+	(void) arg;
+	int values[BATCH];
+	for (int i = 0; i < VALUES_PER_PRODUCER; i += BATCH)
+	{
+		int count = VALUES_PER_PRODUCER - i < BATCH ? VALUES_PER_PRODUCER - i : BATCH;
+		for (int j = 0; j < count; j++)
+			values[j] = i + j;
+		TSDLL_InsertLastN(&queue, values, count);
+	}
+	return NULL;
+}
+
+/** Removes values from the thread-safe list in batches. */
+void *batch_consumer( void *arg ) {
+	(void) arg;
+	int values[BATCH];
+	while (TSDLL_PopFirstN(&queue, values, BATCH) > 0)
+		;
+	return NULL;
+}
+
+/** Closes the thread-safe list once the producers are done. */
+void close_queue( void ) {
+	TSDLL_Close(&queue);
+}
+
+DLList rwlockList;
+pthread_rwlock_t rwlockListLock = PTHREAD_RWLOCK_INITIALIZER;
+RCUDLList rcuList;
+/** Set once all readers have finished, stops the writer. */
+atomic_int readersDone;
+
+/** Looks values up in the c206 list under the read side of a reader-writer lock. */
+void *rwlock_reader( void *arg ) {
+	(void) arg;
+	long found = 0;
+	for (int i = 0; i < LOOKUPS_PER_READER; i++)
+	{
+		int wanted = (i * 7919) % READ_LIST_LENGTH;
+		pthread_rwlock_rdlock(&rwlockListLock);
+		for (DLLElementPtr element = rwlockList.firstElement; element != NULL; element = element->nextElement)
+			if (element->data == wanted)
+			{
+				found++;
+				break;
+			}
+		pthread_rwlock_unlock(&rwlockListLock);
+	}
+	return (void *) found;
+}
+
+/** Moves one value from the beginning to the end of the locked list now and then. */
+void *rwlock_writer( void *arg ) {
+	(void) arg;
+	struct timespec pause = { 0, 50000 };
+	while (!atomic_load(&readersDone))
+	{
+		int value;
+		pthread_rwlock_wrlock(&rwlockListLock);
+		DLL_GetFirst(&rwlockList, &value);
+		DLL_DeleteFirst(&rwlockList);
+		DLL_InsertLast(&rwlockList, value);
+		pthread_rwlock_unlock(&rwlockListLock);
+		nanosleep(&pause, NULL);
+	}
+	return NULL;
+}
+
+/** Looks values up in the read-mostly list. */
+void *rcu_reader( void *arg ) {
+	(void) arg;
+	RCUDLLReader *reader = RCUDLL_RegisterReader(&rcuList);
+	long found = 0;
+	for (int i = 0; i < LOOKUPS_PER_READER; i++)
+	{
+		RCUDLL_ReadLock(reader);
+		found += RCUDLL_Find(&rcuList, (i * 7919) % READ_LIST_LENGTH) != NULL;
+		RCUDLL_ReadUnlock(reader);
+	}
+	RCUDLL_UnregisterReader(reader);
+	return (void *) found;
+}
+
+/** Moves one value from the beginning to the end of the read-mostly list now and then. */
+void *rcu_writer( void *arg ) {
+	(void) arg;
+	struct timespec pause = { 0, 50000 };
+	while (!atomic_load(&readersDone))
+	{
+		int value = RCUDLL_First(&rcuList)->data;
+		RCUDLL_Delete(&rcuList, RCUDLL_First(&rcuList));
+		RCUDLL_InsertLast(&rcuList, value);
+		nanosleep(&pause, NULL);
+	}
+	return NULL;
+}
+
+/** Runs 'readers' copies of 'reader' next to one 'writer' and returns the elapsed time of the readers. */
+double run_readers( int readers, void *(*reader)( void * ), void *(*writer)( void * ) ) {
+	pthread_t readerIds[MAX_THREADS], writerId;
+	atomic_store(&readersDone, 0);
+	pthread_create(&writerId, NULL, writer, NULL);
+	double start = now();
+	for (int i = 0; i < readers; i++)
+		pthread_create(&readerIds[i], NULL, reader, NULL);
+	for (int i = 0; i < readers; i++)
+		pthread_join(readerIds[i], NULL);
+	double elapsed = now() - start;
+	atomic_store(&readersDone, 1);
+	pthread_join(writerId, NULL);
+	return elapsed;
+}
+
+/** Comparison function for qsort. */
+int compare_ints( const void *a, const void *b ) {
+	int x = *(const int *) a, y = *(const int *) b;
+	return (x > y) - (x < y);
+}
+
+/** Sorts the list the old way: copy to an array, qsort, rebuild the list. */
+void copy_sort_rebuild( XDLList *list ) {
+	int *values = malloc(sizeof(int) * (size_t) XDLL_Length(list));
+	int count = 0;
+	for (DLLElementPtr element = list->base.firstElement; element != NULL; element = element->nextElement)
+		values[count++] = element->data;
+	qsort(values, count, sizeof(int), compare_ints);
+	XDLL_Dispose(list);
+	for (int i = 0; i < count; i++)
+		XDLL_InsertLast(list, values[i]);
+	free(values);
+}
+
+/** Fills a list with pseudo-random values, sorts it with 'sort' and returns the time spent sorting. */
+double time_sort( int length, void (*sort)( XDLList * ) ) {
+	XDLList list;
+	XDLL_Init(&list);
+	srand(length);
+	for (int i = 0; i < length; i++)
+		XDLL_InsertLast(&list, rand() - RAND_MAX / 2);
+	double start = now();
+	sort(&list);
+	double elapsed = now() - start;
+	XDLL_Dispose(&list);
+	return elapsed;
+}
+
+/** Number of values loaded into and exported from a list. */
+#define BULK_LENGTH 1000000
+
+/** Loads 'values' with one XDLL_InsertLast per value and returns the time spent. */
+double time_insert_last( XDLList *list, const int *values ) {
+	double start = now();
+	for (int i = 0; i < BULK_LENGTH; i++)
+		XDLL_InsertLast(list, values[i]);
+	return now() - start;
+}
+
+/** Loads 'values' with a single XDLL_InsertLastN and returns the time spent. */
+double time_insert_last_n( XDLList *list, const int *values ) {
+	double start = now();
+	XDLL_InsertLastN(list, values, BULK_LENGTH);
+	return now() - start;
+}
+
+/** Exports the list through the active element and returns the time spent. */
+double time_get_value_export( XDLList *list, int *values ) {
+	double start = now();
+	int count = 0;
+	for (XDLL_First(list); XDLL_IsActive(list); XDLL_Next(list))
+		XDLL_GetValue(list, &values[count++]);
+	return now() - start;
+}
+
+/** Exports the list with XDLL_ToArray and returns the time spent. */
+double time_to_array( XDLList *list, int *values ) {
+	double start = now();
+	XDLL_ToArray(list, values, BULK_LENGTH);
+	return now() - start;
+}
+
+/** Sums the list by following the links and returns the time spent. */
+double time_traversal( XDLList *list ) {
+	double start = now();
+	long long sum = 0;
+	for (DLLElementPtr element = list->base.firstElement; element != NULL; element = element->nextElement)
+		sum += element->data;
+	double elapsed = now() - start;
+	return sum == 42 ? 0 : elapsed;
+}
+
+/** Sums the list through the active element and returns the time spent. */
+double time_get_value_sum( XDLList *list ) {
+	double start = now();
+	long long sum = 0;
+	for (XDLL_First(list); XDLL_IsActive(list); XDLL_Next(list))
+	{
+		int value;
+		XDLL_GetValue(list, &value);
+		sum += value;
+	}
+	double elapsed = now() - start;
+	return sum == 42 ? 0 : elapsed;
+}
+
+/** Sums the list with XDLL_Reduce and returns the time spent. */
+double time_reduce( XDLList *list ) {
+	double start = now();
+	long long sum = XDLL_Reduce(list, DLL_REDUCE_SUM);
+	double elapsed = now() - start;
+	return sum == 42 ? 0 : elapsed;
+}
+
+/** Adds the value to the sum in 'context', used with XDLL_ForEach. */
+void add_to_sum( int *value, void *context ) {
+	*(long long *) context += *value;
+}
+
+/** Sums the list with XDLL_ForEach and returns the time spent. */
+double time_for_each( XDLList *list ) {
+	double start = now();
+	long long sum = 0;
+	XDLL_ForEach(list, add_to_sum, &sum);
+	double elapsed = now() - start;
+	return sum == 42 ? 0 : elapsed;
+}
+
+/** Looks for a value missing from the list with XDLL_Find and returns the time spent. */
+double time_find( XDLList *list ) {
+	double start = now();
+	int found = XDLL_Find(list, -1);
+	double elapsed = now() - start;
+	return found ? 0 : elapsed;
+}
+
+/** Keeps the even values, used with XDLL_ParallelFilter. */
+int is_even( int value, void *context ) {
+	(void) context;
+	return value % 2 == 0;
+}
+
+/** Writes the list as text, one value per line, and returns the time spent. */
+double time_text_save( XDLList *list, const char *path ) {
+	double start = now();
+	FILE *file = fopen(path, "w");
+	for (DLLElementPtr element = list->base.firstElement; element != NULL; element = element->nextElement)
+		fprintf(file, "%d\n", element->data);
+	fclose(file);
+	return now() - start;
+}
+
+/** Reads a text dump with one XDLL_InsertLast per value and returns the time spent. */
+double time_text_load( XDLList *list, const char *path ) {
+	double start = now();
+	FILE *file = fopen(path, "r");
+	int value;
+	while (fscanf(file, "%d", &value) == 1)
+		XDLL_InsertLast(list, value);
+	fclose(file);
+	return now() - start;
+}
+
+/** Runs 'operations' lookups of random keys below 'keys', inserting every missed key, and returns the time spent. */
+double time_lru( LRUCache *cache, int keys, int operations ) {
+	srand(4);
+	double start = now();
+	for (int i = 0; i < operations; i++)
+	{
+		int key = rand() % keys, value;
+		if (!LRU_Get(cache, key, &value))
+			LRU_Put(cache, key, key, 0);
+	}
+	return now() - start;
+}
+
+/** Runs the same workload as time_lru on a plain list searched with XDLL_Find and returns the time spent. */
+double time_list_lru( int capacity, int keys, int operations ) {
+	XDLList list;
+	XDLL_Init(&list);
+	srand(4);
+	double start = now();
+	for (int i = 0; i < operations; i++)
+	{
+		int key = rand() % keys;
+		if (XDLL_Find(&list, key))
+		{
+			XDLL_MoveToFirst(&list, list.base.activeElement);
+			continue;
+		}
+		XDLL_InsertFirst(&list, key);
+		if (XDLL_Length(&list) > capacity)
+			XDLL_DeleteLast(&list);
+	}
+	double elapsed = now() - start;
+	XDLL_Dispose(&list);
+	return elapsed;
+}
+
+/** Record of the payload benchmark, as large as a DLLElement and its malloc header. */
+typedef struct {
+	/** Identifier of the record. */
+	int id;
+	/** Value summed by the benchmark. */
+	double weight;
+	/** Further payload. */
+	char name[16];
+} Record;
+
+DLL_DEFINE(RecordList, Record)
+
+/** Builds a DLList of indices into separately allocated records, sums the weights and returns the time spent. */
+double time_indirect_records( int count ) {
+	double start = now();
+	Record **records = malloc(sizeof(Record *) * count);
+	DLList list;
+	DLL_Init(&list);
+	for (int i = 0; i < count; i++)
+	{
+		records[i] = malloc(sizeof(Record));
+		*records[i] = (Record) { i, i * 0.5, "record" };
+		DLL_InsertLast(&list, i);
+	}
+	double sum = 0;
+	for (DLLElementPtr element = list.firstElement; element != NULL; element = element->nextElement)
+		sum += records[element->data]->weight;
+	for (int i = 0; i < count; i++)
+		free(records[i]);
+	free(records);
+	DLL_Dispose(&list);
+	double elapsed = now() - start;
+	return sum == 42 ? 0 : elapsed;
+}
+
+/** Builds a generated list embedding the records, sums the weights and returns the time spent. */
+double time_inline_records( int count ) {
+	double start = now();
+	RecordList list;
+	RecordList_Init(&list);
+	for (int i = 0; i < count; i++)
+		RecordList_InsertLast(&list, (Record) { i, i * 0.5, "record" });
+	double sum = 0;
+	for (RecordListElement *element = list.firstElement; element != NULL; element = element->nextElement)
+		sum += element->data.weight;
+	RecordList_Dispose(&list);
+	double elapsed = now() - start;
+	return sum == 42 ? 0 : elapsed;
+}
+
+/** Object of the membership benchmark, in an intrusive list and its own array. */
+typedef struct {
+	/** Index of the object in its array. */
+	int id;
+	/** Membership in the intrusive list. */
+	IDLLink link;
+} Member;
+
+/** Puts 'count' objects into a DLList by index, removes every one and returns the time spent. */
+double time_dllist_membership( int count ) {
+	Member *members = malloc(sizeof(Member) * count);
+	double start = now();
+	DLList list;
+	DLL_Init(&list);
+	for (int i = 0; i < count; i++)
+	{
+		members[i].id = i;
+		DLL_InsertLast(&list, i);
+	}
+	while (list.firstElement != NULL)
+		DLL_DeleteFirst(&list);
+	double elapsed = now() - start;
+	free(members);
+	return elapsed;
+}
+
+/** Links 'count' objects into an intrusive list, removes every one and returns the time spent. */
+double time_intrusive_membership( int count ) {
+	Member *members = malloc(sizeof(Member) * count);
+	double start = now();
+	IDLList list;
+	IDLL_Init(&list);
+	for (int i = 0; i < count; i++)
+	{
+		members[i].id = i;
+		IDLL_InsertLast(&list, &members[i].link);
+	}
+	while (list.firstLink != NULL)
+		IDLL_DeleteFirst(&list);
+	double elapsed = now() - start;
+	free(members);
+	return elapsed;
+}
+
+/** Number of short lists of the small-list benchmark. */
+#define SHORT_LISTS 200000
+/** Number of values in every short list. */
+#define SHORT_LENGTH 5
+
+/** Builds SHORT_LISTS DLLists of SHORT_LENGTH values, sums them, disposes them and returns the time spent. */
+double time_short_dllists( void ) {
+	DLList *lists = malloc(sizeof(DLList) * SHORT_LISTS);
+	double start = now();
+	for (int i = 0; i < SHORT_LISTS; i++)
+	{
+		DLL_Init(&lists[i]);
+		for (int j = 0; j < SHORT_LENGTH; j++)
+			DLL_InsertLast(&lists[i], j);
+	}
+	long long sum = 0;
+	for (int i = 0; i < SHORT_LISTS; i++)
+		for (DLLElementPtr element = lists[i].firstElement; element != NULL; element = element->nextElement)
+			sum += element->data;
+	for (int i = 0; i < SHORT_LISTS; i++)
+		DLL_Dispose(&lists[i]);
+	double elapsed = now() - start;
+	free(lists);
+	return sum == 42 ? 0 : elapsed;
+}
+
+/** Builds SHORT_LISTS lists with inline storage, sums them, disposes them and returns the time spent. */
+double time_short_small_lists( void ) {
+	SDLList *lists = malloc(sizeof(SDLList) * SHORT_LISTS);
+	double start = now();
+	for (int i = 0; i < SHORT_LISTS; i++)
+	{
+		SDLL_Init(&lists[i]);
+		for (int j = 0; j < SHORT_LENGTH; j++)
+			SDLL_InsertLast(&lists[i], j);
+	}
+	long long sum = 0;
+	for (int i = 0; i < SHORT_LISTS; i++)
+		for (SDLL_First(&lists[i]); SDLL_IsActive(&lists[i]); SDLL_Next(&lists[i]))
+		{
+			int value;
+			SDLL_GetValue(&lists[i], &value);
+			sum += value;
+		}
+	for (int i = 0; i < SHORT_LISTS; i++)
+		SDLL_Dispose(&lists[i]);
+	double elapsed = now() - start;
+	free(lists);
+	return sum == 42 ? 0 : elapsed;
+}
+
+/** Number of large lists torn down by the disposal benchmark. */
+#define DISPOSED_LISTS 5
+
+/**
+ * Builds and disposes DISPOSED_LISTS lists of 'length' elements, through the reclaimer if
+ * it is given, and returns the longest time a single dispose call took.
+ */
+double time_worst_dispose( int length, DLLReclaimer *reclaimer ) {
+	double worst = 0;
+	for (int i = 0; i < DISPOSED_LISTS; i++)
+	{
+		DLList list;
+		DLL_Init(&list);
+		for (int j = 0; j < length; j++)
+			DLL_InsertLast(&list, j);
+		double start = now();
+		if (reclaimer != NULL)
+			DLL_DisposeAsync(&list, reclaimer);
+		else
+			DLL_Dispose(&list);
+		double elapsed = now() - start;
+		if (elapsed > worst)
+			worst = elapsed;
+	}
+	return worst;
+}
+
+/** Number of random seeks of the seek benchmark. */
+#define SEEKS 2000
+
+/** Seeks SEEKS random positions of 'list' and returns the time spent. */
+double time_random_seeks( XDLList *list ) {
+	srand(5);
+	double start = now();
+	long long sum = 0;
+	for (int i = 0; i < SEEKS; i++)
+	{
+		int value;
+		XDLL_Seek(list, rand() % XDLL_Length(list));
+		XDLL_GetValue(list, &value);
+		sum += value;
+	}
+	double elapsed = now() - start;
+	return sum == 42 ? 0 : elapsed;
+}
+
+/** Inserts after SEEKS random positions of 'list', keeping its length, and returns the time spent. */
+double time_seek_inserts( XDLList *list ) {
+	srand(7);
+	double start = now();
+	for (int i = 0; i < SEEKS; i++)
+	{
+		XDLL_Seek(list, rand() % XDLL_Length(list));
+		XDLL_InsertAfter(list, i);
+		XDLL_DeleteFirst(list);
+	}
+	return now() - start;
+}
+
+/******************************************************************************
+ * Actual benchmarking                                                        *
+ ******************************************************************************/
+
+int main() {
+	printf("C206 - Producer/Consumer Throughput Benchmark\n");
+	printf("---------------------------------------------\n");
+	printf("%10s %10s %18s %18s %18s\n", "producers", "consumers", "mutex [Mops/s]",
+	       "two-lock [Mops/s]", "batched [Mops/s]");
+
+	for (int producers = 1; producers <= MAX_THREADS; producers *= 2)
+	{
+		for (int consumers = 1; consumers <= MAX_THREADS; consumers *= 2)
+		{
+			double values = (double) VALUES_PER_PRODUCER * producers;
+
+			DLL_Init(&mutexList);
+			mutexListRemaining = (long) VALUES_PER_PRODUCER * producers;
+			double mutexTime = run_pipeline((Pipeline) { mutex_producer, mutex_consumer, NULL },
+			                                producers, consumers);
+			DLL_Dispose(&mutexList);
+
+			TSDLL_Init(&queue);
+			double queueTime = run_pipeline((Pipeline) { queue_producer, queue_consumer, close_queue },
+			                                producers, consumers);
+			TSDLL_Dispose(&queue);
+
+			TSDLL_Init(&queue);
+			double batchTime = run_pipeline((Pipeline) { batch_producer, batch_consumer, close_queue },
+			                                producers, consumers);
+			TSDLL_Dispose(&queue);
+
+			printf("%10d %10d %18.2f %18.2f %18.2f\n", producers, consumers,
+			       values / mutexTime / 1e6, values / queueTime / 1e6, values / batchTime / 1e6);
+		}
+	}
+
+	printf("\nC206 - Read-Mostly Lookup Benchmark\n");
+	printf("-----------------------------------\n");
+	printf("%10s %18s %18s\n", "readers", "rwlock [klookup/s]", "RCU [klookup/s]");
+
+	DLL_Init(&rwlockList);
+	RCUDLL_Init(&rcuList, MAX_THREADS);
+	for (int i = 0; i < READ_LIST_LENGTH; i++)
+	{
+		DLL_InsertLast(&rwlockList, i);
+		RCUDLL_InsertLast(&rcuList, i);
+	}
+
+	for (int readers = 1; readers <= MAX_THREADS; readers *= 2)
+	{
+		double lookups = (double) LOOKUPS_PER_READER * readers;
+		double rwlockTime = run_readers(readers, rwlock_reader, rwlock_writer);
+		double rcuTime = run_readers(readers, rcu_reader, rcu_writer);
+		printf("%10d %18.2f %18.2f\n", readers, lookups / rwlockTime / 1e3, lookups / rcuTime / 1e3);
+	}
+
+	RCUDLL_Dispose(&rcuList);
+	DLL_Dispose(&rwlockList);
+
+	printf("\nC206 - Sort Benchmark\n");
+	printf("---------------------\n");
+	printf("%10s %20s %20s %20s\n", "length", "copy+qsort [ms]", "XDLL_Sort [ms]", "XDLL_RadixSort [ms]");
+	for (int length = 10000; length <= 1000000; length *= 10)
+	{
+		printf("%10d %20.2f %20.2f %20.2f\n", length, time_sort(length, copy_sort_rebuild) * 1e3,
+		       time_sort(length, XDLL_Sort) * 1e3, time_sort(length, XDLL_RadixSort) * 1e3);
+	}
+
+	printf("\nC206 - Bulk Load and Export Benchmark (%d values)\n", BULK_LENGTH);
+	printf("------------------------------------------------------\n");
+	printf("%28s %14s %14s\n", "", "load [ms]", "export [ms]");
+	int *bulkValues = malloc(sizeof(int) * BULK_LENGTH);
+	for (int i = 0; i < BULK_LENGTH; i++)
+		bulkValues[i] = i;
+	for (int variant = 0; variant < 4; variant++)
+	{
+		static const char *names[] = { "InsertLast + GetValue", "InsertLastN + ToArray",
+		                               "pooled InsertLast + GetValue", "pooled InsertLastN + ToArray" };
+		double load = 0, export = 0;
+		// The first round only warms up malloc, whose first large request after many
+		// small frees consolidates the freed chunks
+		for (int round = 0; round < 2; round++)
+		{
+			DLLPool pool;
+			XDLList list;
+			DLLPool_Init(&pool, 256);
+			if (variant < 2)
+				XDLL_Init(&list);
+			else
+				XDLL_InitPooled(&list, &pool);
+			load = variant % 2 ? time_insert_last_n(&list, bulkValues) : time_insert_last(&list, bulkValues);
+			export = variant % 2 ? time_to_array(&list, bulkValues) : time_get_value_export(&list, bulkValues);
+			XDLL_Dispose(&list);
+			DLLPool_Dispose(&pool);
+		}
+		printf("%28s %14.2f %14.2f\n", names[variant], load * 1e3, export * 1e3);
+	}
+	free(bulkValues);
+
+	printf("\nC206 - Traversal Before and After XDLL_Compact (%d elements)\n", BULK_LENGTH);
+	printf("-----------------------------------------------------------------\n");
+	{
+		DLLPool pool;
+		XDLList list;
+		DLLPool_Init(&pool, 256);
+		XDLL_InitPooled(&list, &pool);
+		srand(1);
+		for (int i = 0; i < BULK_LENGTH; i++)
+			XDLL_InsertLast(&list, rand());
+		// Sorting random values relinks the elements into a random memory order
+		XDLL_Sort(&list);
+		double scattered = time_traversal(&list);
+		double fragmentation = XDLL_Fragmentation(&list);
+		double start = now();
+		XDLL_Compact(&list);
+		double compaction = now() - start;
+		printf("fragmentation %.2f: %.2f ms, compaction: %.2f ms, compacted: %.2f ms\n", fragmentation,
+		       scattered * 1e3, compaction * 1e3, time_traversal(&list) * 1e3);
+		XDLL_Dispose(&list);
+		DLLPool_Dispose(&pool);
+	}
+
+	printf("\nC206 - Full Scans of a Scattered List (%d elements)\n", 4 * BULK_LENGTH);
+	printf("------------------------------------------------------\n");
+	printf("%28s %14s %14s\n", "", "scattered [ms]", "compacted [ms]");
+	{
+		XDLList list;
+		XDLL_Init(&list);
+		srand(2);
+		// Non-negative values, so that the value searched for by time_find is missing
+		for (int i = 0; i < 4 * BULK_LENGTH; i++)
+			XDLL_InsertLast(&list, rand());
+		XDLL_Sort(&list);
+		static const char *names[] = { "XDLL_Next + XDLL_GetValue", "plain link walk",
+		                               "XDLL_ForEach", "XDLL_Reduce", "XDLL_Find" };
+		double (*scans[])( XDLList * ) = { time_get_value_sum, time_traversal,
+		                                  time_for_each, time_reduce, time_find };
+		double scattered[5];
+		for (int scan = 0; scan < 5; scan++)
+			scattered[scan] = scans[scan](&list);
+		XDLL_Compact(&list);
+		for (int scan = 0; scan < 5; scan++)
+			printf("%28s %14.2f %14.2f\n", names[scan], scattered[scan] * 1e3, scans[scan](&list) * 1e3);
+		XDLL_Dispose(&list);
+	}
+
+	printf("\nC206 - Parallel Operations (%d elements)\n", 4 * BULK_LENGTH);
+	printf("---------------------------------------------\n");
+	printf("%10s %14s %14s %14s\n", "threads", "index [ms]", "reduce [ms]", "filter [ms]");
+	int *parallelValues = malloc(sizeof(int) * 4 * BULK_LENGTH);
+	for (int i = 0; i < 4 * BULK_LENGTH; i++)
+		parallelValues[i] = i;
+	for (int threads = 1; threads <= 2 * MAX_THREADS; threads *= 2)
+	{
+		// A fresh pool lays every run's list out the same way
+		DLLPool pool;
+		XDLList list;
+		DLLPool_Init(&pool, 256);
+		XDLL_InitPooled(&list, &pool);
+		XDLL_InsertLastN(&list, parallelValues, 4 * BULK_LENGTH);
+		DLLSegments segments;
+		double start = now();
+		DLLSegments_Init(&segments, &list, threads);
+		double index = now() - start;
+		start = now();
+		long long sum = XDLL_ParallelReduce(&segments, DLL_REDUCE_SUM);
+		double reduce = now() - start;
+		start = now();
+		XDLL_ParallelFilter(&segments, is_even, NULL);
+		double filter = now() - start;
+		printf("%10d %14.2f %14.2f %14.2f\n", threads, index * 1e3, sum == 42 ? 0 : reduce * 1e3, filter * 1e3);
+		DLLSegments_Dispose(&segments);
+		XDLL_Dispose(&list);
+		DLLPool_Dispose(&pool);
+	}
+	free(parallelValues);
+
+	printf("\nC206 - Save and Restart (%d elements)\n", 4 * BULK_LENGTH);
+	printf("------------------------------------------\n");
+	printf("%28s %14s %14s\n", "", "save [ms]", "load [ms]");
+	{
+		XDLList list;
+		XDLL_Init(&list);
+		srand(3);
+		for (int i = 0; i < 4 * BULK_LENGTH; i++)
+			XDLL_InsertLast(&list, rand());
+		double textSave = time_text_save(&list, "c206-bench.txt");
+		double start = now();
+		XDLL_Save(&list, "c206-bench.dll");
+		double binarySave = now() - start;
+		XDLL_Dispose(&list);
+
+		double textLoad = time_text_load(&list, "c206-bench.txt");
+		XDLL_Dispose(&list);
+		DLLPool pool;
+		DLLPool_Init(&pool, 256);
+		XDLL_InitPooled(&list, &pool);
+		start = now();
+		XDLL_Load(&list, "c206-bench.dll");
+		double binaryLoad = now() - start;
+		XDLL_Dispose(&list);
+		DLLPool_Dispose(&pool);
+
+		printf("%28s %14.2f %14.2f\n", "text + XDLL_InsertLast", textSave * 1e3, textLoad * 1e3);
+		printf("%28s %14.2f %14.2f\n", "XDLL_Save + pooled XDLL_Load", binarySave * 1e3, binaryLoad * 1e3);
+		remove("c206-bench.txt");
+		remove("c206-bench.dll");
+	}
+
+	printf("\nC206 - Persistent List (%d elements)\n", 4 * BULK_LENGTH);
+	printf("----------------------------------------\n");
+	{
+		CDLList compact;
+		CDLL_Init(&compact);
+		double start = now();
+		for (int i = 0; i < 4 * BULK_LENGTH; i++)
+			CDLL_InsertLast(&compact, i);
+		double compactInsert = now() - start;
+		CDLL_Dispose(&compact);
+
+		PDLList persistent;
+		remove("c206-bench.pdl");
+		PDLL_Open(&persistent, "c206-bench.pdl", 0);
+		start = now();
+		for (int i = 0; i < 4 * BULK_LENGTH; i++)
+			PDLL_InsertLast(&persistent, i);
+		double persistentInsert = now() - start;
+		start = now();
+		PDLL_Close(&persistent);
+		double close = now() - start;
+
+		start = now();
+		PDLL_Open(&persistent, "c206-bench.pdl", 0);
+		double reopen = now() - start;
+		start = now();
+		long long sum = 0;
+		for (uint32_t index = persistent.header->firstIndex; index != PDLL_NONE; index = persistent.nodes[index].nextIndex)
+			sum += persistent.nodes[index].data;
+		double scan = now() - start;
+		PDLL_Close(&persistent);
+
+		PDLL_Open(&persistent, "c206-bench.pdl", PDLL_DURABLE);
+		PDLL_First(&persistent);
+		start = now();
+		for (int i = 0; i < 1000; i++)
+		{
+			PDLL_InsertAfter(&persistent, i);
+			PDLL_DeleteAfter(&persistent);
+		}
+		double durable = now() - start;
+		PDLL_Close(&persistent);
+		remove("c206-bench.pdl");
+
+		printf("InsertLast: compact %.2f ms, persistent %.2f ms, close with msync %.2f ms\n",
+		       compactInsert * 1e3, persistentInsert * 1e3, close * 1e3);
+		printf("Reopen: %.3f ms, first scan: %.2f ms\n", reopen * 1e3, sum == 42 ? 0 : scan * 1e3);
+		printf("Durable InsertAfter + DeleteAfter: %.1f us per pair\n", durable / 1000 * 1e6);
+	}
+
+	printf("\nC206 - LRU Cache (lookups of uniform keys, twice as many as the capacity)\n");
+	printf("-------------------------------------------------------------------------\n");
+	printf("%10s %18s %18s %10s\n", "capacity", "LRU [Mops/s]", "XDLL_Find [Mops/s]", "hit rate");
+	for (int capacity = 1000; capacity <= 1000000; capacity *= 10)
+	{
+		int operations = 4 * BULK_LENGTH;
+		LRUCache cache;
+		LRU_Init(&cache, (size_t) capacity, 0);
+		double lru = time_lru(&cache, 2 * capacity, operations);
+		double hitRate = (double) cache.hits / operations;
+		LRU_Dispose(&cache);
+		// The linear search is only affordable for the smallest cache
+		if (capacity == 1000)
+		{
+			int listOperations = operations / 100;
+			printf("%10d %18.2f %18.2f %9.0f%%\n", capacity, operations / lru / 1e6,
+			       listOperations / time_list_lru(capacity, 2 * capacity, listOperations) / 1e6, hitRate * 100);
+		}
+		else
+			printf("%10d %18.2f %18s %9.0f%%\n", capacity, operations / lru / 1e6, "-", hitRate * 100);
+	}
+
+	printf("\nC206 - Records: Build, Sum and Dispose (%d records)\n", BULK_LENGTH);
+	printf("--------------------------------------------------------\n");
+	time_indirect_records(BULK_LENGTH);
+	printf("DLList of indices to malloc'd records: %.2f ms\n", time_indirect_records(BULK_LENGTH) * 1e3);
+	printf("DLL_DEFINE list of inline records:     %.2f ms\n", time_inline_records(BULK_LENGTH) * 1e3);
+
+	printf("\nC206 - Membership: Insert and Remove %d Existing Objects\n", BULK_LENGTH);
+	printf("-------------------------------------------------------------\n");
+	time_dllist_membership(BULK_LENGTH);
+	printf("DLList element per object: %.2f ms\n", time_dllist_membership(BULK_LENGTH) * 1e3);
+	printf("Intrusive link:            %.2f ms\n", time_intrusive_membership(BULK_LENGTH) * 1e3);
+
+	printf("\nC206 - Short Lists: %d Lists of %d Values, Build, Sum and Dispose\n", SHORT_LISTS, SHORT_LENGTH);
+	printf("--------------------------------------------------------------------\n");
+	time_short_dllists();
+	printf("DLList:       %8.2f ms, %4zu bytes per list plus %d allocations\n", time_short_dllists() * 1e3,
+		sizeof(DLList) + SHORT_LENGTH * sizeof(struct DLLElement), SHORT_LENGTH);
+	printf("SDLList:      %8.2f ms, %4zu bytes per list and no allocation\n", time_short_small_lists() * 1e3,
+		sizeof(SDLList));
+
+	printf("\nC206 - Teardown Latency: Longest of %d Disposals of %d Elements\n", DISPOSED_LISTS, BULK_LENGTH);
+	printf("-------------------------------------------------------------------\n");
+	printf("DLL_Dispose:      %8.3f ms\n", time_worst_dispose(BULK_LENGTH, NULL) * 1e3);
+	DLLReclaimer reclaimer;
+	DLLReclaimer_Init(&reclaimer, 4);
+	printf("DLL_DisposeAsync: %8.3f ms\n", time_worst_dispose(BULK_LENGTH, &reclaimer) * 1e3);
+	DLLReclaimer_Drain(&reclaimer);
+	DLLReclaimerStats reclaimerStats;
+	DLLReclaimer_Stats(&reclaimer, &reclaimerStats);
+	printf("Reclaimed in the background: %llu lists, %llu elements, %llu waits for a full queue\n",
+		reclaimerStats.listsReclaimed, reclaimerStats.elementsReclaimed, reclaimerStats.fullWaits);
+	DLLReclaimer_Dispose(&reclaimer);
+
+	printf("\nC206 - Random Seeks: %d Seeks in %d Elements\n", SEEKS, BULK_LENGTH);
+	printf("---------------------------------------------------\n");
+	{
+		XDLList list;
+		XDLL_Init(&list);
+		for (int i = 0; i < BULK_LENGTH; i++)
+			XDLL_InsertLast(&list, i);
+		printf("Nearest of first, last and active: %8.2f ms, with insertions %8.2f ms\n",
+			time_random_seeks(&list) * 1e3, time_seek_inserts(&list) * 1e3);
+		for (int stride = 16; stride <= 1024; stride *= 8)
+		{
+			double start = now();
+			XDLL_SetSeekIndex(&list, stride);
+			double build = now() - start;
+			printf("Seek index of stride %4d:         %8.2f ms, with insertions %8.2f ms, built in %.2f ms\n",
+				stride, time_random_seeks(&list) * 1e3, time_seek_inserts(&list) * 1e3, build * 1e3);
+		}
+		XDLL_Dispose(&list);
+		XDLL_SetSeekIndex(&list, 0);
+	}
+
+	return (0);
+}
+
+/* End of c206-bench.c */
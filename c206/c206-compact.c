@@ -0,0 +1,475 @@
+/**
+ * @file c206-compact.c
+ * @brief Implementation of the compact doubly linked list.
+ * @details Implements the CDLL_* operations declared in c206-compact.h. Every insertion
+ *          goes through CDLL_Link, which places a slot between two neighbours given by
+ *          index, and every deletion through CDLL_Unlink; the public operations only
+ *          pick the neighbours. The array doubles when no free slot is left, and since
+ *          links are indices, the move done by realloc needs no fix-up.
+ *
+ * @code
+ * // Example usage:
+ * CDLList list;
+ * CDLL_Init(&list);
+ * CDLL_Reserve(&list, 1000000); // Optional, avoids the doubling steps
+ * for (int i = 0; i < 1000000; i++) {
+ *     CDLL_InsertLast(&list, i);
+ * }
+ * CDLL_Dispose(&list);          // A single free
+ * @endcode
+ *
+ * @see c206-compact.h for definition of constants and types.
+ *
+ * @see https://github.com/Jekwwer/IAL-Project01-2021 for the project repository.
+ */
+
+#include "c206-compact.h"
+
+/**
+ * @brief Resizes the slot array to the given capacity.
+ *
+ * @param list Pointer to the initialized compact list.
+ * @param capacity New number of slots, not less than list->used.
+ *
+ * @retval int Returns TRUE on success, or FALSE if the array could not be reallocated,
+ *             in which case the list is unchanged.
+ */
+static int CDLL_Resize(CDLList *list, uint32_t capacity) {
+
+    CDLLNode *nodes = (CDLLNode *) realloc(list->nodes, sizeof(CDLLNode) * capacity);
+    if (nodes == NULL) {
+        return FALSE;
+    }
+    list->nodes = nodes;
+    list->capacity = capacity;
+    return TRUE;
+}
+
+/**
+ * @brief Obtains a free slot, growing the array when needed.
+ *
+ * @param list Pointer to the initialized compact list.
+ *
+ * @retval uint32_t Index of the slot, or CDLL_NONE if the array could not grow.
+ */
+static uint32_t CDLL_AllocSlot(CDLList *list) {
+
+    if (list->freeIndex != CDLL_NONE) {
+        uint32_t slot = list->freeIndex;
+        list->freeIndex = list->nodes[slot].nextIndex;
+        return slot;
+    }
+
+    if (list->used == list->capacity) {
+        // The last index is reserved for CDLL_NONE
+        if (list->capacity == CDLL_NONE - 1) {
+            return CDLL_NONE;
+        }
+        uint32_t capacity = list->capacity < 4 ? 8 : list->capacity * 2;
+        if (list->capacity > (CDLL_NONE - 1) / 2) {
+            capacity = CDLL_NONE - 1;
+        }
+        if (!CDLL_Resize(list, capacity)) {
+            return CDLL_NONE;
+        }
+    }
+    return list->used++;
+}
+
+/**
+ * @brief Links a slot with data between two neighbouring elements.
+ *
+ * @param list Pointer to the initialized compact list.
+ * @param data Value of the new element.
+ * @param previousIndex Element the new one follows, or CDLL_NONE to insert it first.
+ * @param nextIndex Element the new one precedes, or CDLL_NONE to insert it last.
+ *
+ * @post The element is linked, or DLL_Error is called if no slot could be obtained.
+ */
+static void CDLL_Link(CDLList *list, int data, uint32_t previousIndex, uint32_t nextIndex) {
+
+    uint32_t slot = CDLL_AllocSlot(list);
+    if (slot == CDLL_NONE) {
+        DLL_Error();
+        return;
+    }
+
+    CDLLNode *node = &list->nodes[slot];
+    node->data = data;
+    node->previousIndex = previousIndex;
+    node->nextIndex = nextIndex;
+
+    if (previousIndex != CDLL_NONE) {
+        list->nodes[previousIndex].nextIndex = slot;
+    } else {
+        list->firstIndex = slot;
+    }
+    if (nextIndex != CDLL_NONE) {
+        list->nodes[nextIndex].previousIndex = slot;
+    } else {
+        list->lastIndex = slot;
+    }
+}
+
+/**
+ * @brief Unlinks an element and recycles its slot.
+ *
+ * @param list Pointer to the initialized compact list.
+ * @param slot Index of the element to delete.
+ *
+ * @post The element is removed; if it was active, the list becomes inactive.
+ */
+static void CDLL_Unlink(CDLList *list, uint32_t slot) {
+
+    CDLLNode *node = &list->nodes[slot];
+
+    if (node->previousIndex != CDLL_NONE) {
+        list->nodes[node->previousIndex].nextIndex = node->nextIndex;
+    } else {
+        list->firstIndex = node->nextIndex;
+    }
+    if (node->nextIndex != CDLL_NONE) {
+        list->nodes[node->nextIndex].previousIndex = node->previousIndex;
+    } else {
+        list->lastIndex = node->previousIndex;
+    }
+    if (list->activeIndex == slot) {
+        list->activeIndex = CDLL_NONE;
+    }
+
+    node->nextIndex = list->freeIndex;
+    list->freeIndex = slot;
+}
+
+/**
+ * @brief Initializes the compact list.
+ *
+ * @param list Pointer to the compact list structure to be initialized.
+ *
+ * @post The list is empty, inactive and holds no memory.
+ *
+ * @return This function does not return a value.
+ */
+void CDLL_Init(CDLList *list) {
+
+    list->nodes = NULL;
+    list->capacity = 0;
+    list->used = 0;
+    list->firstIndex = CDLL_NONE;
+    list->activeIndex = CDLL_NONE;
+    list->lastIndex = CDLL_NONE;
+    list->freeIndex = CDLL_NONE;
+}
+
+/**
+ * @brief Deletes all elements of the compact list and reinitializes it.
+ *
+ * @details The elements share one array, so disposing of the list is a single free
+ *          regardless of its length.
+ *
+ * @param list Pointer to the initialized compact list.
+ *
+ * @post The list is in the same state as after CDLL_Init.
+ *
+ * @return This function does not return a value.
+ */
+void CDLL_Dispose(CDLList *list) {
+
+    free(list->nodes);
+    CDLL_Init(list);
+}
+
+/**
+ * @brief Makes room for the given number of slots in advance.
+ *
+ * @details Loading a list of known size after a reservation performs no reallocation.
+ *          A capacity below the current one is ignored.
+ *
+ * @param list Pointer to the initialized compact list.
+ * @param capacity Number of slots the array should hold.
+ *
+ * @post If the array cannot be grown, DLL_Error is called and the list is unchanged.
+ *
+ * @return This function does not return a value.
+ */
+void CDLL_Reserve(CDLList *list, uint32_t capacity) {
+
+    if (capacity == CDLL_NONE) {
+        capacity = CDLL_NONE - 1;
+    }
+    if (capacity > list->capacity && !CDLL_Resize(list, capacity)) {
+        DLL_Error();
+    }
+}
+
+/**
+ * @brief Inserts a new element at the beginning of the list.
+ *
+ * @param list Pointer to the initialized compact list.
+ * @param data Value to be inserted.
+ *
+ * @post If no slot can be obtained, DLL_Error is called and the list is unchanged.
+ *
+ * @return This function does not return a value.
+ */
+void CDLL_InsertFirst(CDLList *list, int data) {
+
+    CDLL_Link(list, data, CDLL_NONE, list->firstIndex);
+}
+
+/**
+ * @brief Inserts a new element at the end of the list.
+ *
+ * @param list Pointer to the initialized compact list.
+ * @param data Value to be inserted.
+ *
+ * @post If no slot can be obtained, DLL_Error is called and the list is unchanged.
+ *
+ * @return This function does not return a value.
+ */
+void CDLL_InsertLast(CDLList *list, int data) {
+
+    CDLL_Link(list, data, list->lastIndex, CDLL_NONE);
+}
+
+/**
+ * @brief Sets the first element of the list as active.
+ *
+ * @param list Pointer to the initialized compact list.
+ *
+ * @return This function does not return a value.
+ */
+void CDLL_First(CDLList *list) {
+
+    list->activeIndex = list->firstIndex;
+}
+
+/**
+ * @brief Sets the last element of the list as active.
+ *
+ * @param list Pointer to the initialized compact list.
+ *
+ * @return This function does not return a value.
+ */
+void CDLL_Last(CDLList *list) {
+
+    list->activeIndex = list->lastIndex;
+}
+
+/**
+ * @brief Returns the value of the first element.
+ *
+ * @param list Pointer to the initialized compact list.
+ * @param dataPtr Pointer to the destination variable.
+ *
+ * @post If the list is empty, DLL_Error is called and the variable is left untouched.
+ *
+ * @return This function does not return a value.
+ */
+void CDLL_GetFirst(CDLList *list, int *dataPtr) {
+
+    if (list->firstIndex == CDLL_NONE) {
+        DLL_Error();
+    } else {
+        *dataPtr = list->nodes[list->firstIndex].data;
+    }
+}
+
+/**
+ * @brief Returns the value of the last element.
+ *
+ * @param list Pointer to the initialized compact list.
+ * @param dataPtr Pointer to the destination variable.
+ *
+ * @post If the list is empty, DLL_Error is called and the variable is left untouched.
+ *
+ * @return This function does not return a value.
+ */
+void CDLL_GetLast(CDLList *list, int *dataPtr) {
+
+    if (list->lastIndex == CDLL_NONE) {
+        DLL_Error();
+    } else {
+        *dataPtr = list->nodes[list->lastIndex].data;
+    }
+}
+
+/**
+ * @brief Deletes the first element of the list.
+ *
+ * @param list Pointer to the initialized compact list.
+ *
+ * @post Nothing happens if the list is empty.
+ *
+ * @return This function does not return a value.
+ */
+void CDLL_DeleteFirst(CDLList *list) {
+
+    if (list->firstIndex != CDLL_NONE) {
+        CDLL_Unlink(list, list->firstIndex);
+    }
+}
+
+/**
+ * @brief Deletes the last element of the list.
+ *
+ * @param list Pointer to the initialized compact list.
+ *
+ * @post Nothing happens if the list is empty.
+ *
+ * @return This function does not return a value.
+ */
+void CDLL_DeleteLast(CDLList *list) {
+
+    if (list->lastIndex != CDLL_NONE) {
+        CDLL_Unlink(list, list->lastIndex);
+    }
+}
+
+/**
+ * @brief Deletes the element following the active one.
+ *
+ * @param list Pointer to the initialized compact list.
+ *
+ * @post Nothing happens if the list is inactive or the active element is the last one.
+ *
+ * @return This function does not return a value.
+ */
+void CDLL_DeleteAfter(CDLList *list) {
+
+    if (CDLL_IsActive(list) && list->nodes[list->activeIndex].nextIndex != CDLL_NONE) {
+        CDLL_Unlink(list, list->nodes[list->activeIndex].nextIndex);
+    }
+}
+
+/**
+ * @brief Deletes the element preceding the active one.
+ *
+ * @param list Pointer to the initialized compact list.
+ *
+ * @post Nothing happens if the list is inactive or the active element is the first one.
+ *
+ * @return This function does not return a value.
+ */
+void CDLL_DeleteBefore(CDLList *list) {
+
+    if (CDLL_IsActive(list) && list->nodes[list->activeIndex].previousIndex != CDLL_NONE) {
+        CDLL_Unlink(list, list->nodes[list->activeIndex].previousIndex);
+    }
+}
+
+/**
+ * @brief Inserts a new element after the active one.
+ *
+ * @param list Pointer to the initialized compact list.
+ * @param data Value to be inserted.
+ *
+ * @post Nothing happens if the list is inactive.
+ *
+ * @return This function does not return a value.
+ */
+void CDLL_InsertAfter(CDLList *list, int data) {
+
+    if (CDLL_IsActive(list)) {
+        CDLL_Link(list, data, list->activeIndex, list->nodes[list->activeIndex].nextIndex);
+    }
+}
+
+/**
+ * @brief Inserts a new element before the active one.
+ *
+ * @param list Pointer to the initialized compact list.
+ * @param data Value to be inserted.
+ *
+ * @post Nothing happens if the list is inactive.
+ *
+ * @return This function does not return a value.
+ */
+void CDLL_InsertBefore(CDLList *list, int data) {
+
+    if (CDLL_IsActive(list)) {
+        CDLL_Link(list, data, list->nodes[list->activeIndex].previousIndex, list->activeIndex);
+    }
+}
+
+/**
+ * @brief Returns the value of the active element.
+ *
+ * @param list Pointer to the initialized compact list.
+ * @param dataPtr Pointer to the destination variable.
+ *
+ * @post If the list is inactive, DLL_Error is called and the variable is left untouched.
+ *
+ * @return This function does not return a value.
+ */
+void CDLL_GetValue(CDLList *list, int *dataPtr) {
+
+    if (!CDLL_IsActive(list)) {
+        DLL_Error();
+    } else {
+        *dataPtr = list->nodes[list->activeIndex].data;
+    }
+}
+
+/**
+ * @brief Overwrites the value of the active element.
+ *
+ * @param list Pointer to the initialized compact list.
+ * @param data New value.
+ *
+ * @post Nothing happens if the list is inactive.
+ *
+ * @return This function does not return a value.
+ */
+void CDLL_SetValue(CDLList *list, int data) {
+
+    if (CDLL_IsActive(list)) {
+        list->nodes[list->activeIndex].data = data;
+    }
+}
+
+/**
+ * @brief Moves the activity to the next element.
+ *
+ * @param list Pointer to the initialized compact list.
+ *
+ * @post The list becomes inactive after its last element.
+ *
+ * @return This function does not return a value.
+ */
+void CDLL_Next(CDLList *list) {
+
+    if (CDLL_IsActive(list)) {
+        list->activeIndex = list->nodes[list->activeIndex].nextIndex;
+    }
+}
+
+/**
+ * @brief Moves the activity to the previous element.
+ *
+ * @param list Pointer to the initialized compact list.
+ *
+ * @post The list becomes inactive before its first element.
+ *
+ * @return This function does not return a value.
+ */
+void CDLL_Previous(CDLList *list) {
+
+    if (CDLL_IsActive(list)) {
+        list->activeIndex = list->nodes[list->activeIndex].previousIndex;
+    }
+}
+
+/**
+ * @brief Checks whether the list is active.
+ *
+ * @param list Pointer to the initialized compact list.
+ *
+ * @retval int Returns a non-zero value if the list has an active element, otherwise zero.
+ */
+int CDLL_IsActive(CDLList *list) {
+
+    return list->activeIndex != CDLL_NONE;
+}
+
+/* End of c206-compact.c */
@@ -0,0 +1,98 @@
+/**
+ * @file c206-compact.h
+ * @brief Compact doubly linked list stored in a single array.
+ * @details Declares a list variant whose elements are slots of one growable array and
+ *          whose links are 32-bit slot indices instead of pointers. An element takes
+ *          12 bytes instead of the 24 bytes of a DLLElement plus its malloc header, and
+ *          the whole list is a single block: it can be relocated by realloc, copied or
+ *          written out as is, because no link refers to an absolute address.
+ *
+ *          The operations mirror the DLL_* operations of c206.h one to one. Deleted
+ *          slots are recycled through a free list threaded via their next indices.
+ *
+ * @see c206.h for the list the variant mirrors.
+ *
+ * @see https://github.com/Jekwwer/IAL-Project01-2021 for the project repository.
+ */
+
+#ifndef _CDLL_H_
+#define _CDLL_H_
+
+#include <stdint.h>
+
+#include "c206-ext.h"
+
+/** Index marking the absence of an element. */
+#define CDLL_NONE UINT32_MAX
+
+/** Element of the compact list. */
+typedef struct {
+	/** Useful data. */
+	int data;
+	/** Index of the previous element in the list. */
+	uint32_t previousIndex;
+	/** Index of the next element in the list, or of the next free slot. */
+	uint32_t nextIndex;
+} CDLLNode;
+
+/** Compact doubly linked list. */
+typedef struct {
+	/** Array of slots holding the elements. */
+	CDLLNode *nodes;
+	/** Number of slots in the array. */
+	uint32_t capacity;
+	/** Number of slots that have ever been used; slots above are untouched. */
+	uint32_t used;
+	/** Index of the first element in the list. */
+	uint32_t firstIndex;
+	/** Index of the current element in the list. */
+	uint32_t activeIndex;
+	/** Index of the last element in the list. */
+	uint32_t lastIndex;
+	/** Index of the first recycled free slot. */
+	uint32_t freeIndex;
+} CDLList;
+
+void CDLL_Init( CDLList * );
+
+void CDLL_Dispose( CDLList * );
+
+void CDLL_Reserve( CDLList *, uint32_t );
+
+void CDLL_InsertFirst( CDLList *, int );
+
+void CDLL_InsertLast( CDLList *, int );
+
+void CDLL_First( CDLList * );
+
+void CDLL_Last( CDLList * );
+
+void CDLL_GetFirst( CDLList *, int * );
+
+void CDLL_GetLast( CDLList *, int * );
+
+void CDLL_DeleteFirst( CDLList * );
+
+void CDLL_DeleteLast( CDLList * );
+
+void CDLL_DeleteAfter( CDLList * );
+
+void CDLL_DeleteBefore( CDLList * );
+
+void CDLL_InsertAfter( CDLList *, int );
+
+void CDLL_InsertBefore( CDLList *, int );
+
+void CDLL_GetValue( CDLList *, int * );
+
+void CDLL_SetValue( CDLList *, int );
+
+void CDLL_Next( CDLList * );
+
+void CDLL_Previous( CDLList * );
+
+int CDLL_IsActive( CDLList * );
+
+#endif
+
+/* End of c206-compact.h */
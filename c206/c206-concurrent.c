@@ -0,0 +1,349 @@
+/**
+ * @file c206-concurrent.c
+ * @brief Thread-safe list implementation file.
+ * @details Implements the two-lock list declared in c206-concurrent.h. Producers link new
+ *          nodes behind the last node under the tail lock; consumers move the sentinel
+ *          forward under the head lock and free the old sentinel after unlocking.
+ *
+ *          A consumer that finds the list empty waits on a condition variable tied to the
+ *          head lock. Producers do not take the head lock on every insertion: a consumer
+ *          announces itself in 'waiters' before it checks the list, and a producer reads
+ *          'waiters' after it links the new node. Both accesses are sequentially
+ *          consistent, so either the consumer sees the node or the producer sees the
+ *          waiter and signals it under the head lock, and no wakeup is lost.
+ *
+ *          The functions implemented are:
+ *          - TSDLL_Init:         Creates the sentinel, the locks and the condition.
+ *          - TSDLL_Dispose:      Releases all nodes, the locks and the condition.
+ *          - TSDLL_IsEmpty:      Checks if the list is empty.
+ *          - TSDLL_InsertLast:   Inserts one value at the end.
+ *          - TSDLL_InsertLastN:  Inserts several values at the end at once.
+ *          - TSDLL_PopFirst:     Removes the first value, waiting for one if necessary.
+ *          - TSDLL_TryPopFirst:  Removes the first value if there is one.
+ *          - TSDLL_PopFirstN:    Removes up to N values, waiting for the first one.
+ *          - TSDLL_TryPopFirstN: Removes up to N values without waiting.
+ *          - TSDLL_Close:        Stops consumers from waiting for further values.
+ *
+ * @code
+ * // Using example
+ * TSDLList queue;
+ * TSDLL_Init(&queue);
+ * // Producer threads
+ * TSDLL_InsertLast(&queue, 42);
+ * // Consumer threads
+ * int value;
+ * while (TSDLL_PopFirst(&queue, &value)) {
+ *     // Process value
+ * }
+ * // After all producers have finished
+ * TSDLL_Close(&queue);
+ * // After all consumers have finished
+ * TSDLL_Dispose(&queue);
+ * @endcode
+ *
+ * @see c206-concurrent.h for type definitions.
+ *
+ * @see https://github.com/Jekwwer/IAL-Project01-2021 for the project repository.
+ */
+
+#include "c206-concurrent.h"
+
+/**
+ * @brief Allocates a node holding a value.
+ *
+ * @param data Value of the node.
+ *
+ * @retval TSDLLNode* The node with no successor, or NULL if the memory could not be
+ *                    allocated.
+ */
+static TSDLLNode *TSDLL_NewNode(int data) {
+
+    TSDLLNode *node = (TSDLLNode *) malloc(sizeof(TSDLLNode));
+    if (node != NULL) {
+        node->data = data;
+        atomic_init(&node->nextNode, NULL);
+    }
+    return node;
+}
+
+/**
+ * @brief Links a chain of nodes behind the last node and wakes waiting consumers.
+ *
+ * @param list Pointer to the initialized list.
+ * @param first First node of the chain.
+ * @param last Last node of the chain.
+ * @param wakeAll Nonzero to wake all waiting consumers, zero to wake one.
+ */
+static void TSDLL_Append(TSDLList *list, TSDLLNode *first, TSDLLNode *last, int wakeAll) {
+
+    pthread_mutex_lock(&list->tailLock);
+    atomic_store(&list->tail->nextNode, first);
+    list->tail = last;
+    pthread_mutex_unlock(&list->tailLock);
+
+    // Pairs with the increment of 'waiters' in TSDLL_Take
+    if (atomic_load(&list->waiters) > 0) {
+        pthread_mutex_lock(&list->headLock);
+        if (wakeAll) {
+            pthread_cond_broadcast(&list->nonEmpty);
+        } else {
+            pthread_cond_signal(&list->nonEmpty);
+        }
+        pthread_mutex_unlock(&list->headLock);
+    }
+}
+
+/**
+ * @brief Removes up to 'count' values from the beginning of the list.
+ *
+ * @param list Pointer to the initialized list.
+ * @param values Array receiving the values.
+ * @param count Maximum number of values to remove.
+ * @param wait Nonzero to wait for a value while the list is empty and not closed.
+ *
+ * @retval int Number of values removed.
+ */
+static int TSDLL_Take(TSDLList *list, int *values, int count, int wait) {
+
+    if (count <= 0) {
+        return 0;
+    }
+
+    pthread_mutex_lock(&list->headLock);
+
+    TSDLLNode *next = atomic_load(&list->head->nextNode);
+    if (next == NULL && wait) {
+        // Announce the wait before checking again, see TSDLL_Append
+        atomic_fetch_add(&list->waiters, 1);
+        while ((next = atomic_load(&list->head->nextNode)) == NULL && !list->closed) {
+            pthread_cond_wait(&list->nonEmpty, &list->headLock);
+        }
+        atomic_fetch_sub(&list->waiters, 1);
+    }
+
+    TSDLLNode *oldHead = list->head;
+    int taken = 0;
+    while (next != NULL && taken < count) {
+        values[taken++] = next->data;
+        list->head = next;
+        next = atomic_load_explicit(&next->nextNode, memory_order_acquire);
+    }
+    TSDLLNode *newHead = list->head;
+
+    pthread_mutex_unlock(&list->headLock);
+
+    // The removed nodes are private now, free them outside of the lock
+    while (oldHead != newHead) {
+        TSDLLNode *node = oldHead;
+        oldHead = atomic_load_explicit(&node->nextNode, memory_order_relaxed);
+        free(node);
+    }
+    return taken;
+}
+
+/**
+ * @brief Initializes the thread-safe list.
+ *
+ * @param list Pointer to the list structure to be initialized.
+ *
+ * @post The list is empty and open. If the sentinel cannot be allocated, DLL_Error is
+ *       called and the list must not be used.
+ *
+ * @return This function does not return a value.
+ */
+void TSDLL_Init(TSDLList *list) {
+
+    pthread_mutex_init(&list->headLock, NULL);
+    pthread_mutex_init(&list->tailLock, NULL);
+    pthread_cond_init(&list->nonEmpty, NULL);
+    atomic_init(&list->waiters, 0);
+    list->closed = FALSE;
+    list->head = list->tail = TSDLL_NewNode(0);
+    if (list->head == NULL) {
+        DLL_Error();
+    }
+}
+
+/**
+ * @brief Releases all nodes of the list together with its locks.
+ *
+ * @param list Pointer to the initialized list.
+ *
+ * @pre No other thread may use the list anymore.
+ *
+ * @return This function does not return a value.
+ */
+void TSDLL_Dispose(TSDLList *list) {
+
+    TSDLLNode *node = list->head;
+    while (node != NULL) {
+        TSDLLNode *next = atomic_load_explicit(&node->nextNode, memory_order_relaxed);
+        free(node);
+        node = next;
+    }
+    list->head = list->tail = NULL;
+
+    pthread_cond_destroy(&list->nonEmpty);
+    pthread_mutex_destroy(&list->tailLock);
+    pthread_mutex_destroy(&list->headLock);
+}
+
+/**
+ * @brief Checks whether the list is empty.
+ *
+ * @param list Pointer to the initialized list.
+ *
+ * @retval int Nonzero if the list was empty at the time of the call. Other threads may
+ *             change the list before the caller acts on the result.
+ */
+int TSDLL_IsEmpty(TSDLList *list) {
+
+    pthread_mutex_lock(&list->headLock);
+    int empty = atomic_load(&list->head->nextNode) == NULL;
+    pthread_mutex_unlock(&list->headLock);
+    return empty;
+}
+
+/**
+ * @brief Inserts a value at the end of the list.
+ *
+ * @param list Pointer to the initialized list.
+ * @param data Value to insert.
+ *
+ * @post The value is the last one and one waiting consumer is woken up.
+ *
+ * @retval int TRUE on success, FALSE if the memory could not be allocated.
+ */
+int TSDLL_InsertLast(TSDLList *list, int data) {
+
+    TSDLLNode *node = TSDLL_NewNode(data);
+    if (node == NULL) {
+        return FALSE;
+    }
+    TSDLL_Append(list, node, node, FALSE);
+    return TRUE;
+}
+
+/**
+ * @brief Inserts several values at the end of the list at once.
+ *
+ * @details The nodes are allocated and linked together before the tail lock is taken,
+ *          so the lock is held for a single link however many values are inserted, and
+ *          consumers see either none or all of them.
+ *
+ * @param list Pointer to the initialized list.
+ * @param values Values to insert, in order.
+ * @param count Number of values.
+ *
+ * @post The values are the last ones and all waiting consumers are woken up.
+ *
+ * @retval int TRUE on success, FALSE if the memory could not be allocated, in which case
+ *             none of the values is inserted.
+ */
+int TSDLL_InsertLastN(TSDLList *list, const int *values, int count) {
+
+    if (count <= 0) {
+        return TRUE;
+    }
+
+    TSDLLNode *first = NULL;
+    TSDLLNode *last = NULL;
+    for (int i = 0; i < count; i++) {
+        TSDLLNode *node = TSDLL_NewNode(values[i]);
+        if (node == NULL) {
+            // Drop the partial chain, nobody has seen it yet
+            while (first != NULL) {
+                TSDLLNode *next = atomic_load_explicit(&first->nextNode, memory_order_relaxed);
+                free(first);
+                first = next;
+            }
+            return FALSE;
+        }
+        if (last == NULL) {
+            first = node;
+        } else {
+            atomic_store_explicit(&last->nextNode, node, memory_order_relaxed);
+        }
+        last = node;
+    }
+
+    TSDLL_Append(list, first, last, count > 1);
+    return TRUE;
+}
+
+/**
+ * @brief Removes the first value, waiting until there is one.
+ *
+ * @param list Pointer to the initialized list.
+ * @param dataPtr Pointer to the variable receiving the value.
+ *
+ * @retval int TRUE if a value was removed, FALSE if the list is empty and closed.
+ */
+int TSDLL_PopFirst(TSDLList *list, int *dataPtr) {
+
+    return TSDLL_Take(list, dataPtr, 1, TRUE);
+}
+
+/**
+ * @brief Removes the first value if there is one.
+ *
+ * @param list Pointer to the initialized list.
+ * @param dataPtr Pointer to the variable receiving the value.
+ *
+ * @retval int TRUE if a value was removed, FALSE if the list was empty.
+ */
+int TSDLL_TryPopFirst(TSDLList *list, int *dataPtr) {
+
+    return TSDLL_Take(list, dataPtr, 1, FALSE);
+}
+
+/**
+ * @brief Removes up to 'count' values, waiting until there is at least one.
+ *
+ * @details All values are taken under a single acquisition of the head lock, which
+ *          divides the locking cost among them.
+ *
+ * @param list Pointer to the initialized list.
+ * @param values Array of at least 'count' elements receiving the values in order.
+ * @param count Maximum number of values to remove.
+ *
+ * @retval int Number of values removed, zero only if the list is empty and closed.
+ */
+int TSDLL_PopFirstN(TSDLList *list, int *values, int count) {
+
+    return TSDLL_Take(list, values, count, TRUE);
+}
+
+/**
+ * @brief Removes up to 'count' values without waiting.
+ *
+ * @param list Pointer to the initialized list.
+ * @param values Array of at least 'count' elements receiving the values in order.
+ * @param count Maximum number of values to remove.
+ *
+ * @retval int Number of values removed, zero if the list was empty.
+ */
+int TSDLL_TryPopFirstN(TSDLList *list, int *values, int count) {
+
+    return TSDLL_Take(list, values, count, FALSE);
+}
+
+/**
+ * @brief Tells the consumers that no more values will be inserted.
+ *
+ * @param list Pointer to the initialized list.
+ *
+ * @post Waiting consumers are woken up. The values still in the list can be removed as
+ *       before, but once the list is empty the waiting operations return at once.
+ *
+ * @return This function does not return a value.
+ */
+void TSDLL_Close(TSDLList *list) {
+
+    pthread_mutex_lock(&list->headLock);
+    list->closed = TRUE;
+    pthread_cond_broadcast(&list->nonEmpty);
+    pthread_mutex_unlock(&list->headLock);
+}
+
+/* End of c206-concurrent.c */
@@ -0,0 +1,85 @@
+/**
+ * @file c206-concurrent.h
+ * @brief Thread-safe list of integers for producer/consumer pipelines.
+ * @details Declares the list used as a work queue between pipeline stages: producers
+ *          insert values at the end and consumers take them from the beginning, which
+ *          are the only two places where DLList is used concurrently. Instead of one
+ *          mutex around the whole list, the beginning and the end have a lock each, so
+ *          a producer and a consumer never wait for one another (two-lock queue).
+ *
+ *          The list always contains a sentinel node in front of the first value. The
+ *          consumers own the sentinel and the producers own the last node, so the two
+ *          sides only share the link of the last node while the list is empty, and that
+ *          link is atomic.
+ *
+ *          Consumers can wait for values (TSDLL_PopFirst) or return immediately
+ *          (TSDLL_TryPopFirst), and both have a variant taking up to N values under a
+ *          single lock acquisition. TSDLL_Close wakes all waiting consumers once the
+ *          producers are done.
+ *
+ * @note Like the c202 lock-free stack, the operations report their outcome through the
+ *       return value instead of DLL_Error, because checking the list first and acting
+ *       afterwards is a race when other threads use it.
+ *
+ * @see c206.h for the single-threaded list.
+ *
+ * @see https://github.com/Jekwwer/IAL-Project01-2021 for the project repository.
+ */
+
+#ifndef _TSDLL_H_
+#define _TSDLL_H_
+
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "c206-ext.h"
+
+/** Node of the thread-safe list. */
+typedef struct TSDLLNode {
+	/** Useful data. */
+	int data;
+	/** Pointer to the next node, written by producers and read by consumers. */
+	_Atomic(struct TSDLLNode *) nextNode;
+} TSDLLNode;
+
+/** Thread-safe list, the consumer and producer halves lie on separate cache lines. */
+typedef struct {
+	/** Lock of the beginning of the list, held by consumers. */
+	_Alignas(64) pthread_mutex_t headLock;
+	/** Sentinel node, the first value is in the node after it. */
+	TSDLLNode *head;
+	/** Signalled when a value is inserted into an empty list, used with 'headLock'. */
+	pthread_cond_t nonEmpty;
+	/** Number of consumers waiting on 'nonEmpty'. */
+	_Atomic int waiters;
+	/** Nonzero after TSDLL_Close, changed under 'headLock'. */
+	int closed;
+	/** Lock of the end of the list, held by producers. */
+	_Alignas(64) pthread_mutex_t tailLock;
+	/** Last node of the list, the sentinel if the list is empty. */
+	TSDLLNode *tail;
+} TSDLList;
+
+void TSDLL_Init( TSDLList * );
+
+void TSDLL_Dispose( TSDLList * );
+
+int TSDLL_IsEmpty( TSDLList * );
+
+int TSDLL_InsertLast( TSDLList *, int );
+
+int TSDLL_InsertLastN( TSDLList *, const int *, int );
+
+int TSDLL_PopFirst( TSDLList *, int * );
+
+int TSDLL_TryPopFirst( TSDLList *, int * );
+
+int TSDLL_PopFirstN( TSDLList *, int *, int );
+
+int TSDLL_TryPopFirstN( TSDLList *, int *, int );
+
+void TSDLL_Close( TSDLList * );
+
+#endif
+
+/* End of c206-concurrent.h */
@@ -0,0 +1,2722 @@
+/**
+ * @file c206-ext.c
+ * @brief Implementation of the extended operations on the doubly linked list.
+ * @details Implements the XDLL_* operations declared in c206-ext.h on an XDLList, which
+ *          wraps the DLList of c206.h together with its length, the position of its
+ *          active element, its pool, its cursors and the state of the compaction and
+ *          the seek index.
+ *
+ *          The operations that only move the activity or read and write values are
+ *          forwarded to the DLL_* operations of c206.c on the embedded list. Insertions
+ *          and deletions are implemented here, because they take their elements from
+ *          the pool and keep the length, the active position and the cursors up to
+ *          date in constant time.
+ *
+ * @note Elements are allocated one by one with malloc unless the list was initialized
+ *       with XDLL_InitPooled. Pooled lists take their elements from a DLLPool, which
+ *       carves them out of larger slabs and recycles deleted elements through an
+ *       intrusive free list, so inserting and deleting is only a matter of relinking.
+ *
+ * @code
+ * // Example usage:
+ * XDLList list;
+ * XDLL_Init(&list);
+ * XDLL_InsertLast(&list, 1);
+ * XDLL_Seek(&list, 0);
+ * XDLL_Dispose(&list);
+ * @endcode
+ *
+ * @see c206-ext.h for definition of constants and types.
+ *
+ * @see https://github.com/Jekwwer/IAL-Project01-2021 for the project repository.
+ */
+
+#include "c206-ext.h"
+
+#include <stdint.h>
+#include <string.h>
+
+/** Number of elements the scanning functions prefetch ahead of the visited one. */
+#ifndef DLL_PREFETCH_DISTANCE
+#define DLL_PREFETCH_DISTANCE 8
+#endif
+
+#if defined(__GNUC__)
+#define DLL_PREFETCH(address) __builtin_prefetch(address)
+#else
+#define DLL_PREFETCH(address) ((void) (address))
+#endif
+
+/**
+ * @brief Initializes a pool of list elements.
+ * 
+ * @details The pool starts without any memory. Slabs of 'elementsPerSlab' elements are
+ *          allocated on demand when the free list runs out, so the per-element cost of
+ *          malloc is paid once per slab.
+ * 
+ * @param pool Pointer to the pool structure to be initialized.
+ * @param elementsPerSlab Number of elements allocated with every slab, at least one.
+ * 
+ * @post The pool is empty and can be passed to XDLL_InitPooled by any number of lists.
+ * 
+ * @code
+ *   DLLPool pool;
+ *   DLLPool_Init(&pool, 1024);
+ *   XDLList first, second;
+ *   XDLL_InitPooled(&first, &pool);
+ *   XDLL_InitPooled(&second, &pool);
+ * @endcode
+ * 
+ * @return This function does not return a value.
+ */
+void DLLPool_Init(DLLPool *pool, size_t elementsPerSlab) {
+
+    pool->slabs = NULL;
+    pool->freeElements = NULL;
+    pool->freeCount = 0;
+    pool->elementsPerSlab = elementsPerSlab > 0 ? elementsPerSlab : 1;
+}
+
+/**
+ * @brief Releases all memory held by a pool.
+ * 
+ * @details Frees the slabs of the pool one by one, so the cost is proportional to the
+ *          number of slabs rather than to the number of elements ever allocated.
+ * 
+ * @param pool Pointer to the initialized pool structure.
+ * 
+ * @pre No list may use the pool anymore. Lists that still hold elements of the pool
+ *      have to be disposed of first, or simply abandoned together with the pool.
+ * 
+ * @post The pool is empty as after DLLPool_Init and can be used again.
+ * 
+ * @warning Elements of lists still using the pool become dangling pointers.
+ * 
+ * @return This function does not return a value.
+ */
+void DLLPool_Dispose(DLLPool *pool) {
+
+    while (pool->slabs != NULL) {
+        DLLSlab *slab = pool->slabs;
+        pool->slabs = slab->nextSlab;
+        free(slab);
+    }
+    pool->freeElements = NULL;
+    pool->freeCount = 0;
+}
+
+/**
+ * @brief Allocates a slab and puts its elements in front of the pool's free list.
+ * 
+ * @param pool Pointer to the initialized pool structure.
+ * @param elementCount Number of elements in the new slab, at least one.
+ * 
+ * @post The next 'elementCount' elements taken from the pool are consecutive in memory.
+ * 
+ * @retval int TRUE on success, FALSE if the memory could not be allocated.
+ */
+static int DLLPool_AddSlab(DLLPool *pool, size_t elementCount) {
+
+    DLLSlab *slab = (DLLSlab *) malloc(sizeof(DLLSlab) + sizeof(struct DLLElement) * elementCount);
+    if (slab == NULL) {
+        return FALSE;
+    }
+    slab->nextSlab = pool->slabs;
+    slab->elementCount = elementCount;
+    pool->slabs = slab;
+
+    // Thread the new elements into the free list in address order
+    for (size_t i = 0; i + 1 < elementCount; i++) {
+        slab->elements[i].nextElement = &slab->elements[i + 1];
+    }
+    slab->elements[elementCount - 1].nextElement = pool->freeElements;
+    pool->freeElements = &slab->elements[0];
+    pool->freeCount += elementCount;
+    return TRUE;
+}
+
+/**
+ * @brief Merges two chains of elements sorted by address.
+ * 
+ * @param first Chain linked through the next pointers, in ascending address order.
+ * @param second Another such chain.
+ * 
+ * @retval DLLElementPtr Head of the merged chain.
+ */
+static DLLElementPtr DLLPool_MergeElements(DLLElementPtr first, DLLElementPtr second) {
+
+    struct DLLElement head;
+    DLLElementPtr tail = &head;
+    while (first != NULL && second != NULL) {
+        if ((uintptr_t) second < (uintptr_t) first) {
+            tail->nextElement = second;
+            second = second->nextElement;
+        } else {
+            tail->nextElement = first;
+            first = first->nextElement;
+        }
+        tail = tail->nextElement;
+    }
+    tail->nextElement = first != NULL ? first : second;
+    return head.nextElement;
+}
+
+/**
+ * @brief Sorts a chain of elements linked through their next pointers by address.
+ * 
+ * @details The bottom-up merge sort of XDLL_Sort, ordering by address instead of value.
+ * 
+ * @param chain Head of the chain, may be NULL.
+ * 
+ * @retval DLLElementPtr Head of the sorted chain.
+ */
+static DLLElementPtr DLLPool_SortElements(DLLElementPtr chain) {
+
+    DLLElementPtr runs[sizeof(size_t) * 8] = { NULL };
+    int levels = 0;
+    while (chain != NULL) {
+        DLLElementPtr run = chain;
+        chain = chain->nextElement;
+        run->nextElement = NULL;
+
+        int level = 0;
+        for (; runs[level] != NULL; level++) {
+            run = DLLPool_MergeElements(runs[level], run);
+            runs[level] = NULL;
+        }
+        runs[level] = run;
+        if (level >= levels) {
+            levels = level + 1;
+        }
+    }
+
+    DLLElementPtr sorted = NULL;
+    for (int level = 0; level < levels; level++) {
+        if (runs[level] != NULL) {
+            sorted = DLLPool_MergeElements(runs[level], sorted);
+        }
+    }
+    return sorted;
+}
+
+/**
+ * @brief Merges two chains of slabs sorted by address.
+ * 
+ * @param first Chain linked through the next pointers, in ascending address order.
+ * @param second Another such chain.
+ * 
+ * @retval DLLSlab* Head of the merged chain.
+ */
+static DLLSlab *DLLPool_MergeSlabs(DLLSlab *first, DLLSlab *second) {
+
+    DLLSlab head;
+    DLLSlab *tail = &head;
+    while (first != NULL && second != NULL) {
+        if ((uintptr_t) second < (uintptr_t) first) {
+            tail->nextSlab = second;
+            second = second->nextSlab;
+        } else {
+            tail->nextSlab = first;
+            first = first->nextSlab;
+        }
+        tail = tail->nextSlab;
+    }
+    tail->nextSlab = first != NULL ? first : second;
+    return head.nextSlab;
+}
+
+/**
+ * @brief Sorts a chain of slabs by address, like DLLPool_SortElements.
+ * 
+ * @param chain Head of the chain, may be NULL.
+ * 
+ * @retval DLLSlab* Head of the sorted chain.
+ */
+static DLLSlab *DLLPool_SortSlabs(DLLSlab *chain) {
+
+    DLLSlab *runs[sizeof(size_t) * 8] = { NULL };
+    int levels = 0;
+    while (chain != NULL) {
+        DLLSlab *run = chain;
+        chain = chain->nextSlab;
+        run->nextSlab = NULL;
+
+        int level = 0;
+        for (; runs[level] != NULL; level++) {
+            run = DLLPool_MergeSlabs(runs[level], run);
+            runs[level] = NULL;
+        }
+        runs[level] = run;
+        if (level >= levels) {
+            levels = level + 1;
+        }
+    }
+
+    DLLSlab *sorted = NULL;
+    for (int level = 0; level < levels; level++) {
+        if (runs[level] != NULL) {
+            sorted = DLLPool_MergeSlabs(runs[level], sorted);
+        }
+    }
+    return sorted;
+}
+
+/**
+ * @brief Releases the slabs of a pool none of whose elements is in use.
+ * 
+ * @details Sorts both the free list and the slabs by address, so that the free elements
+ *          of every slab form one run of the free list, and walks them side by side. A
+ *          slab whose run covers all of its elements is freed together with the run.
+ *          The cost is O(f log f + s log s) for f free elements and s slabs.
+ * 
+ * @param pool Pointer to the initialized pool structure.
+ * 
+ * @post Every remaining slab holds at least one element used by a list. The free list
+ *       holds the remaining free elements in address order, so the next insertions take
+ *       consecutive elements wherever a slab has consecutive free ones.
+ * 
+ * @code
+ *   XDLL_Dispose(&bigList);
+ *   DLLPool_Trim(&pool);        // Return the memory bigList no longer uses
+ * @endcode
+ * 
+ * @return This function does not return a value.
+ */
+void DLLPool_Trim(DLLPool *pool) {
+
+    DLLElementPtr element = DLLPool_SortElements(pool->freeElements);
+    DLLSlab *slab = DLLPool_SortSlabs(pool->slabs);
+
+    struct DLLElement kept;
+    DLLElementPtr keptLast = &kept;
+    DLLSlab **slabLink = &pool->slabs;
+    while (slab != NULL) {
+        DLLSlab *nextSlab = slab->nextSlab;
+
+        // Free elements below this slab belong to the slabs already visited
+        uintptr_t end = (uintptr_t) (slab->elements + slab->elementCount);
+        DLLElementPtr run = element;
+        DLLElementPtr runLast = NULL;
+        size_t count = 0;
+        while (element != NULL && (uintptr_t) element < end) {
+            runLast = element;
+            element = element->nextElement;
+            count++;
+        }
+
+        if (count == slab->elementCount) {
+            pool->freeCount -= count;
+            free(slab);
+        } else {
+            *slabLink = slab;
+            slabLink = &slab->nextSlab;
+            if (count > 0) {
+                keptLast->nextElement = run;
+                keptLast = runLast;
+            }
+        }
+        slab = nextSlab;
+    }
+    *slabLink = NULL;
+    keptLast->nextElement = NULL;
+    pool->freeElements = kept.nextElement;
+}
+
+/**
+ * @brief Obtains storage for a new element of the list.
+ * 
+ * @details Non-pooled lists use malloc. Pooled lists pop an element from the free list
+ *          of their pool and allocate a new slab only when the free list is empty.
+ * 
+ * @param list Pointer to the initialized doubly linked list structure.
+ * 
+ * @retval DLLElementPtr The new element with undefined contents, or NULL if the memory
+ *                       could not be allocated.
+ */
+static DLLElementPtr XDLL_AllocElement(XDLList *list) {
+
+    if (list->compactThreshold > 0) {
+        list->churn++;
+    }
+    DLLPool *pool = list->pool;
+    if (pool == NULL) {
+        return (DLLElementPtr) malloc(sizeof(struct DLLElement));
+    }
+
+    if (pool->freeElements == NULL && !DLLPool_AddSlab(pool, pool->elementsPerSlab)) {
+        return NULL;
+    }
+
+    DLLElementPtr element = pool->freeElements;
+    pool->freeElements = element->nextElement;
+    pool->freeCount--;
+    return element;
+}
+
+/**
+ * @brief Returns the storage of a removed element.
+ * 
+ * @details Every removal of an element passes through here, so this is where the
+ *          cursors still pointing at the element are deactivated.
+ * 
+ * @param list Pointer to the list the element was removed from.
+ * @param element The element, already unlinked from the list.
+ * 
+ * @post The element is freed, or pushed on the free list of the list's pool. No cursor
+ *       of the list points at it any more.
+ */
+static void XDLL_FreeElement(XDLList *list, DLLElementPtr element) {
+
+    for (XDLLCursor *cursor = list->cursors; cursor != NULL; cursor = cursor->nextCursor) {
+        if (cursor->element == element) {
+            cursor->element = NULL;
+        }
+    }
+    if (list->compactThreshold > 0) {
+        list->churn++;
+    }
+    if (list->pool == NULL) {
+        free(element);
+    } else {
+        element->nextElement = list->pool->freeElements;
+        list->pool->freeElements = element;
+        list->pool->freeCount++;
+    }
+}
+
+/**
+ * @brief Returns the slot of the hash table of a seek index where the search for an
+ *        element starts.
+ * 
+ * @param index Pointer to the seek index.
+ * @param element Element to look for.
+ * 
+ * @retval size_t Slot between 0 and the capacity of the table minus one.
+ */
+static size_t XDLL_SeekSlot(const DLLSeekIndex *index, DLLElementPtr element) {
+
+    uint64_t hash = (uint64_t) (uintptr_t) element * UINT64_C(0x9E3779B97F4A7C15);
+    return (size_t) (hash >> 32) & (index->capacity - 1);
+}
+
+/**
+ * @brief Finds the node of a sampled element.
+ * 
+ * @param index Pointer to the seek index.
+ * @param element Element of the list.
+ * 
+ * @retval DLLSeekNode* The node sampling 'element', or NULL if the element is not sampled.
+ */
+static DLLSeekNode *XDLL_SeekLookup(const DLLSeekIndex *index, DLLElementPtr element) {
+
+    size_t mask = index->capacity - 1;
+    for (size_t slot = XDLL_SeekSlot(index, element); index->table[slot] != NULL; slot = (slot + 1) & mask) {
+        if (index->table[slot]->element == element) {
+            return index->table[slot];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Enters a node into the hash table of a seek index.
+ * 
+ * @details The table is kept at most half full and doubled when needed.
+ * 
+ * @param index Pointer to the seek index.
+ * @param node Node whose element is not in the table yet.
+ * 
+ * @retval int TRUE on success, FALSE if the table could not be enlarged.
+ */
+static int XDLL_SeekAddSlot(DLLSeekIndex *index, DLLSeekNode *node) {
+
+    if ((index->count + 1) * 2 > index->capacity) {
+        DLLSeekNode **old = index->table;
+        size_t oldCapacity = index->capacity;
+        DLLSeekNode **table = (DLLSeekNode **) calloc(oldCapacity * 2, sizeof(DLLSeekNode *));
+        if (table == NULL) {
+            return FALSE;
+        }
+        index->table = table;
+        index->capacity = oldCapacity * 2;
+        for (size_t slot = 0; slot < oldCapacity; slot++) {
+            if (old[slot] != NULL) {
+                size_t target = XDLL_SeekSlot(index, old[slot]->element);
+                while (table[target] != NULL) {
+                    target = (target + 1) & (index->capacity - 1);
+                }
+                table[target] = old[slot];
+            }
+        }
+        free(old);
+    }
+
+    size_t slot = XDLL_SeekSlot(index, node->element);
+    while (index->table[slot] != NULL) {
+        slot = (slot + 1) & (index->capacity - 1);
+    }
+    index->table[slot] = node;
+    index->count++;
+    return TRUE;
+}
+
+/**
+ * @brief Removes a node from the hash table of a seek index.
+ * 
+ * @details The entries following the freed slot are shifted back where their search
+ *          would otherwise stop early, so no tombstones are needed.
+ * 
+ * @param index Pointer to the seek index.
+ * @param node Node in the table.
+ */
+static void XDLL_SeekRemoveSlot(DLLSeekIndex *index, DLLSeekNode *node) {
+
+    size_t mask = index->capacity - 1;
+    size_t hole = XDLL_SeekSlot(index, node->element);
+    while (index->table[hole] != node) {
+        hole = (hole + 1) & mask;
+    }
+    for (size_t slot = (hole + 1) & mask; index->table[slot] != NULL; slot = (slot + 1) & mask) {
+        size_t home = XDLL_SeekSlot(index, index->table[slot]->element);
+        if (((slot - home) & mask) >= ((slot - hole) & mask)) {
+            index->table[hole] = index->table[slot];
+            hole = slot;
+        }
+    }
+    index->table[hole] = NULL;
+    index->count--;
+}
+
+/**
+ * @brief Finds the node whose run contains an element.
+ * 
+ * @details Walks back from the element to the nearest sampled one, which takes at most
+ *          twice the stride of the index.
+ * 
+ * @param index Pointer to the seek index.
+ * @param element Element of the list, or NULL for the position before the first one.
+ * 
+ * @retval DLLSeekNode* The node of the run, the head if no sample precedes the element.
+ */
+static DLLSeekNode *XDLL_SeekRunOf(const DLLSeekIndex *index, DLLElementPtr element) {
+
+    for (; element != NULL; element = element->previousElement) {
+        DLLSeekNode *node = XDLL_SeekLookup(index, element);
+        if (node != NULL) {
+            return node;
+        }
+    }
+    return index->head;
+}
+
+/**
+ * @brief Changes the number of elements of a run on every level that spans it.
+ * 
+ * @details On each level the spanning node is the nearest node at or before the run
+ *          that is linked on the level; it is found by stepping back along the level
+ *          below, which takes two steps per level on average.
+ * 
+ * @param index Pointer to the seek index.
+ * @param node Node of the run.
+ * @param delta Number of elements added to the run, negative for removed elements.
+ */
+static void XDLL_SeekAdjust(DLLSeekIndex *index, DLLSeekNode *node, int delta) {
+
+    for (int level = 0; level < index->levels; level++) {
+        while (node->levels <= level) {
+            node = node->links[level - 1].previous;
+        }
+        node->links[level].span += delta;
+    }
+}
+
+/**
+ * @brief Samples an element inside a run, splitting the run in two.
+ * 
+ * @param list Pointer to the list of the index.
+ * @param run Node of the run containing the element.
+ * @param element Element to sample, not the first element of the run.
+ * @param offset Number of elements of the run in front of 'element'.
+ * 
+ * @retval DLLSeekNode* The new node, or NULL if the memory could not be allocated, in
+ *                      which case the index is unchanged.
+ */
+static DLLSeekNode *XDLL_SeekAddNode(XDLList *list, DLLSeekNode *run, DLLElementPtr element, int offset) {
+
+    DLLSeekIndex *index = list->seekIndex;
+
+    // Every further level with half the probability of the one below
+    index->random ^= index->random << 13;
+    index->random ^= index->random >> 17;
+    index->random ^= index->random << 5;
+    unsigned bits = index->random;
+    int levels = 1;
+    for (; levels < DLL_SEEK_LEVELS && (bits & 1u); bits >>= 1) {
+        levels++;
+    }
+
+    DLLSeekNode *node = (DLLSeekNode *) malloc(sizeof(DLLSeekNode) + sizeof(DLLSeekLink) * levels);
+    if (node == NULL) {
+        return NULL;
+    }
+    node->element = element;
+    node->levels = levels;
+    if (!XDLL_SeekAddSlot(index, node)) {
+        free(node);
+        return NULL;
+    }
+    for (; index->levels < levels; index->levels++) {
+        index->head->links[index->levels].span = list->length;
+    }
+
+    // 'distance' counts the elements from the start of 'previous' to the new sample
+    DLLSeekNode *previous = run;
+    int distance = offset;
+    for (int level = 0; level < levels; level++) {
+        while (previous->levels <= level) {
+            previous = previous->links[level - 1].previous;
+            distance += previous->links[level - 1].span;
+        }
+        DLLSeekLink *link = &previous->links[level];
+        node->links[level].next = link->next;
+        node->links[level].previous = previous;
+        node->links[level].span = link->span - distance;
+        link->next->links[level].previous = node;
+        link->next = node;
+        link->span = distance;
+    }
+    return node;
+}
+
+/**
+ * @brief Removes a node, handing its run over to the preceding node.
+ * 
+ * @param index Pointer to the seek index.
+ * @param node Node other than the head.
+ */
+static void XDLL_SeekRemoveNode(DLLSeekIndex *index, DLLSeekNode *node) {
+
+    for (int level = 0; level < node->levels; level++) {
+        DLLSeekLink *link = &node->links[level];
+        link->previous->links[level].span += link->span;
+        link->previous->links[level].next = link->next;
+        link->next->links[level].previous = link->previous;
+    }
+    XDLL_SeekRemoveSlot(index, node);
+    free(node);
+}
+
+/**
+ * @brief Splits a run that has grown beyond twice the stride.
+ * 
+ * @param list Pointer to the list of the index.
+ * @param run Node of the run.
+ * 
+ * @post Every run split off holds 'stride' elements and the rest at most twice as many,
+ *       unless a node could not be allocated, which only makes seeks into the run walk
+ *       further.
+ */
+static void XDLL_SeekSplit(XDLList *list, DLLSeekNode *run) {
+
+    DLLSeekIndex *index = list->seekIndex;
+    while (run->links[0].span > 2 * index->stride) {
+        DLLElementPtr element = run == index->head ? list->base.firstElement : run->element;
+        for (int i = 0; i < index->stride; i++) {
+            element = element->nextElement;
+        }
+        run = XDLL_SeekAddNode(list, run, element, index->stride);
+        if (run == NULL) {
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Merges a run with its neighbours while together they hold at most the stride.
+ * 
+ * @param index Pointer to the seek index.
+ * @param run Node of a run that has lost elements.
+ */
+static void XDLL_SeekMerge(DLLSeekIndex *index, DLLSeekNode *run) {
+
+    DLLSeekNode *next = run->links[0].next;
+    if (next != index->head && run->links[0].span + next->links[0].span <= index->stride) {
+        XDLL_SeekRemoveNode(index, next);
+    }
+    DLLSeekNode *previous = run->links[0].previous;
+    if (run != index->head && previous->links[0].span + run->links[0].span <= index->stride) {
+        XDLL_SeekRemoveNode(index, run);
+    }
+}
+
+/**
+ * @brief Removes all samples from a seek index.
+ * 
+ * @param index Pointer to the seek index.
+ * 
+ * @post The index describes an empty list; its table keeps its capacity.
+ */
+static void XDLL_SeekClear(DLLSeekIndex *index) {
+
+    DLLSeekNode *head = index->head;
+    for (DLLSeekNode *node = head->links[0].next; node != head;) {
+        DLLSeekNode *next = node->links[0].next;
+        free(node);
+        node = next;
+    }
+    for (int level = 0; level < DLL_SEEK_LEVELS; level++) {
+        head->links[level] = (DLLSeekLink) { head, head, 0 };
+    }
+    memset(index->table, 0, sizeof(DLLSeekNode *) * index->capacity);
+    index->count = 0;
+    index->levels = 1;
+}
+
+/**
+ * @brief Accounts for elements just linked into the list in its seek index.
+ * 
+ * @details The new elements join the run of the element they follow, which is then
+ *          split as needed. This takes O(log n) steps on the levels of the index plus
+ *          walks of up to twice the stride, and additionally a walk over the new
+ *          elements when more than the stride of them are inserted at once.
+ * 
+ * @param list Pointer to the list, whose length already includes the new elements.
+ * @param first First of the new elements, which follow each other.
+ * @param count Number of new elements.
+ */
+static void XDLL_SeekInserted(XDLList *list, DLLElementPtr first, int count) {
+
+    DLLSeekIndex *index = list->seekIndex;
+    if (index == NULL) {
+        return;
+    }
+    DLLSeekNode *run = XDLL_SeekRunOf(index, first->previousElement);
+    XDLL_SeekAdjust(index, run, count);
+    XDLL_SeekSplit(list, run);
+}
+
+/**
+ * @brief Accounts for elements about to be unlinked from the list in its seek index.
+ * 
+ * @details The removed elements are subtracted from the runs they belong to. A sample
+ *          among them moves to the first remaining element of its run, or its node is
+ *          removed if the whole run goes, and the run in front of the range is merged
+ *          with its neighbours if they became short.
+ * 
+ * @param list Pointer to the list, still holding the elements.
+ * @param first First element to be removed.
+ * @param last Last element to be removed, 'first' or an element following it.
+ */
+static void XDLL_SeekRemoved(XDLList *list, DLLElementPtr first, DLLElementPtr last) {
+
+    DLLSeekIndex *index = list->seekIndex;
+    if (index == NULL) {
+        return;
+    }
+
+    // Subtract the elements run by run and count the samples among them
+    DLLSeekNode *run = XDLL_SeekRunOf(index, first);
+    DLLSeekNode *before = run->element == first ? run->links[0].previous : run;
+    int samples = run->element == first;
+    int removed = 0;
+    for (DLLElementPtr element = first; ; element = element->nextElement) {
+        DLLSeekNode *node = element != first ? XDLL_SeekLookup(index, element) : NULL;
+        if (node != NULL) {
+            XDLL_SeekAdjust(index, run, -removed);
+            run = node;
+            removed = 0;
+            samples++;
+        }
+        removed++;
+        if (element == last) {
+            break;
+        }
+    }
+    XDLL_SeekAdjust(index, run, -removed);
+
+    // Only the last sample in the range can have elements left behind the range
+    DLLSeekNode *node = before->links[0].next;
+    for (; samples > 0; samples--) {
+        DLLSeekNode *next = node->links[0].next;
+        if (node->links[0].span > 0) {
+            XDLL_SeekRemoveSlot(index, node);
+            node->element = last->nextElement;
+            XDLL_SeekAddSlot(index, node);
+        } else {
+            XDLL_SeekRemoveNode(index, node);
+        }
+        node = next;
+    }
+    XDLL_SeekMerge(index, before);
+}
+
+/**
+ * @brief Samples the whole list anew.
+ * 
+ * @details Used after operations that move most elements anyway, such as sorting.
+ * 
+ * @param list Pointer to the list.
+ */
+static void XDLL_SeekRebuild(XDLList *list) {
+
+    DLLSeekIndex *index = list->seekIndex;
+    if (index == NULL) {
+        return;
+    }
+    XDLL_SeekClear(index);
+    index->head->links[0].span = list->length;
+    XDLL_SeekSplit(list, index->head);
+}
+
+/**
+ * @brief Links a new element between two neighbouring elements.
+ * 
+ * @param list Pointer to the initialized doubly linked list structure.
+ * @param previous Element the new one follows, or NULL to insert at the beginning.
+ * @param next Element the new one precedes, or NULL to insert at the end.
+ * @param data Value of the new element.
+ * 
+ * @post The element is linked in and counted in the length of the list and in its seek
+ *       index. The position of the active element is not adjusted.
+ * 
+ * @retval DLLElementPtr The new element, or NULL if the memory could not be allocated,
+ *                       in which case DLL_Error has been called.
+ */
+static DLLElementPtr XDLL_LinkBetween(XDLList *list, DLLElementPtr previous, DLLElementPtr next, int data) {
+
+    DLLElementPtr element = XDLL_AllocElement(list);
+    if (element == NULL) {
+        DLL_Error();
+        return NULL;
+    }
+
+    element->data = data;
+    element->previousElement = previous;
+    element->nextElement = next;
+    if (previous != NULL) {
+        previous->nextElement = element;
+    } else {
+        list->base.firstElement = element;
+    }
+    if (next != NULL) {
+        next->previousElement = element;
+    } else {
+        list->base.lastElement = element;
+    }
+    list->length++;
+    XDLL_SeekInserted(list, element, 1);
+    return element;
+}
+
+/**
+ * @brief Unlinks an element from the list and releases it.
+ * 
+ * @param list Pointer to the initialized doubly linked list structure.
+ * @param element Element of the list to remove.
+ * 
+ * @post The element is removed and freed. If it was active, the list is inactive, and
+ *       cursors on it are inactive. The position of the active element is not adjusted.
+ */
+static void XDLL_Unlink(XDLList *list, DLLElementPtr element) {
+
+    XDLL_SeekRemoved(list, element, element);
+    if (element->previousElement != NULL) {
+        element->previousElement->nextElement = element->nextElement;
+    } else {
+        list->base.firstElement = element->nextElement;
+    }
+    if (element->nextElement != NULL) {
+        element->nextElement->previousElement = element->previousElement;
+    } else {
+        list->base.lastElement = element->previousElement;
+    }
+    if (list->base.activeElement == element) {
+        list->base.activeElement = NULL;
+    }
+    list->length--;
+    XDLL_FreeElement(list, element);
+}
+
+/**
+ * @brief Initializes the list.
+ * 
+ * @param list Pointer to the list structure to be initialized.
+ * 
+ * @post The list is empty and inactive, allocates its elements with malloc, has no
+ *       cursors, no automatic compaction and no seek index.
+ * 
+ * @return This function does not return a value.
+ */
+void XDLL_Init(XDLList *list) {
+
+    DLL_Init(&list->base);
+    list->pool = NULL;
+    list->length = 0;
+    list->activePosition = -1;
+    list->cursors = NULL;
+    list->compactThreshold = 0;
+    list->churn = 0;
+    list->seekIndex = NULL;
+}
+
+/**
+ * @brief Initializes the list whose elements come from a pool.
+ * 
+ * @details Behaves as XDLL_Init, but all elements of the list are taken from and returned
+ *          to 'pool'. The pool may be shared by several lists; it is not thread-safe.
+ * 
+ * @param list Pointer to the list structure to be initialized.
+ * @param pool Pointer to the initialized pool, which must outlive the list.
+ * 
+ * @post The list is empty and every later insertion reuses a free element of the pool.
+ * 
+ * @code
+ *   DLLPool pool;
+ *   DLLPool_Init(&pool, 256);
+ *   XDLList myList;
+ *   XDLL_InitPooled(&myList, &pool);
+ *   XDLL_InsertLast(&myList, 10);
+ *   XDLL_Dispose(&myList);      // O(1), the elements go back to the pool
+ *   DLLPool_Dispose(&pool);     // O(number of slabs)
+ * @endcode
+ * 
+ * @return This function does not return a value.
+ */
+void XDLL_InitPooled(XDLList *list, DLLPool *pool) {
+
+    XDLL_Init(list);
+    list->pool = pool;
+}
+
+/**
+ * @brief Deletes all elements of the list and reinitializes it.
+ * 
+ * @details A pooled list returns all of its elements to its pool in constant time by
+ *          prepending the whole chain to the pool's free list. Other lists free their
+ *          elements with DLL_Dispose.
+ * 
+ * @param list Pointer to the initialized list.
+ * 
+ * @post The list is empty and inactive. It keeps its pool, its cursors, which become
+ *       inactive, its automatic compaction threshold and its emptied seek index.
+ * 
+ * @return This function does not return a value.
+ */
+void XDLL_Dispose(XDLList *list) {
+
+    DLLPool *pool = list->pool;
+    XDLLCursor *cursors = list->cursors;
+
+    // Deactivate the cursors once here rather than once per freed element
+    for (XDLLCursor *cursor = cursors; cursor != NULL; cursor = cursor->nextCursor) {
+        cursor->element = NULL;
+    }
+
+    if (pool != NULL) {
+        // The elements are already linked forward, hand the whole chain to the pool at once
+        if (list->base.lastElement != NULL) {
+            list->base.lastElement->nextElement = pool->freeElements;
+            pool->freeElements = list->base.firstElement;
+            pool->freeCount += list->length;
+        }
+    } else {
+        DLL_Dispose(&list->base);
+    }
+
+    double compactThreshold = list->compactThreshold;
+    DLLSeekIndex *seekIndex = list->seekIndex;
+    if (seekIndex != NULL) {
+        XDLL_SeekClear(seekIndex);
+    }
+    XDLL_Init(list);
+    list->pool = pool;
+    list->cursors = cursors;
+    list->compactThreshold = compactThreshold;
+    list->seekIndex = seekIndex;
+}
+
+/**
+ * @brief Inserts a new element at the beginning of the list.
+ * 
+ * @param list Pointer to the initialized list.
+ * @param data Value to be inserted.
+ * 
+ * @post If the memory cannot be allocated, DLL_Error is called and the list is unchanged.
+ * 
+ * @return This function does not return a value.
+ */
+void XDLL_InsertFirst(XDLList *list, int data) {
+
+    if (XDLL_LinkBetween(list, NULL, list->base.firstElement, data) != NULL && list->activePosition >= 0) {
+        list->activePosition++;
+    }
+}
+
+/**
+ * @brief Inserts a new element at the end of the list.
+ * 
+ * @param list Pointer to the initialized list.
+ * @param data Value to be inserted.
+ * 
+ * @post If the memory cannot be allocated, DLL_Error is called and the list is unchanged.
+ * 
+ * @return This function does not return a value.
+ */
+void XDLL_InsertLast(XDLList *list, int data) {
+
+    XDLL_LinkBetween(list, list->base.lastElement, NULL, data);
+}
+
+/**
+ * @brief Sets the first element of the list as active.
+ * 
+ * @param list Pointer to the initialized list.
+ * 
+ * @return This function does not return a value.
+ */
+void XDLL_First(XDLList *list) {
+
+    DLL_First(&list->base);
+    list->activePosition = 0;
+}
+
+/**
+ * @brief Sets the last element of the list as active.
+ * 
+ * @param list Pointer to the initialized list.
+ * 
+ * @return This function does not return a value.
+ */
+void XDLL_Last(XDLList *list) {
+
+    DLL_Last(&list->base);
+    list->activePosition = list->length - 1;
+}
+
+/**
+ * @brief Retrieves the value of the first element.
+ * 
+ * @param list Pointer to the initialized list.
+ * @param dataPtr Pointer receiving the value.
+ * 
+ * @post If the list is empty, DLL_Error is called.
+ * 
+ * @return This function does not return a value.
+ */
+void XDLL_GetFirst(XDLList *list, int *dataPtr) {
+
+    DLL_GetFirst(&list->base, dataPtr);
+}
+
+/**
+ * @brief Retrieves the value of the last element.
+ * 
+ * @param list Pointer to the initialized list.
+ * @param dataPtr Pointer receiving the value.
+ * 
+ * @post If the list is empty, DLL_Error is called.
+ * 
+ * @return This function does not return a value.
+ */
+void XDLL_GetLast(XDLList *list, int *dataPtr) {
+
+    DLL_GetLast(&list->base, dataPtr);
+}
+
+/**
+ * @brief Deletes the first element of the list.
+ * 
+ * @param list Pointer to the initialized list.
+ * 
+ * @post If the element was active, the list becomes inactive. Nothing happens if the
+ *       list is empty.
+ * 
+ * @return This function does not return a value.
+ */
+void XDLL_DeleteFirst(XDLList *list) {
+
+    DLLElementPtr element = list->base.firstElement;
+    if (element == NULL) {
+        return;
+    }
+
+    if (list->base.activeElement != element && list->activePosition >= 0) {
+        list->activePosition--;
+    }
+    XDLL_Unlink(list, element);
+}
+
+/**
+ * @brief Deletes the last element of the list.
+ * 
+ * @param list Pointer to the initialized list.
+ * 
+ * @post If the element was active, the list becomes inactive. Nothing happens if the
+ *       list is empty.
+ * 
+ * @return This function does not return a value.
+ */
+void XDLL_DeleteLast(XDLList *list) {
+
+    if (list->base.lastElement != NULL) {
+        XDLL_Unlink(list, list->base.lastElement);
+    }
+}
+
+/**
+ * @brief Deletes the element after the active one.
+ * 
+ * @param list Pointer to the initialized list.
+ * 
+ * @post Nothing happens if the list is inactive or its last element is active.
+ * 
+ * @return This function does not return a value.
+ */
+void XDLL_DeleteAfter(XDLList *list) {
+
+    DLLElementPtr active = list->base.activeElement;
+    if (active != NULL && active->nextElement != NULL) {
+        XDLL_Unlink(list, active->nextElement);
+    }
+}
+
+/**
+ * @brief Deletes the element before the active one.
+ * 
+ * @param list Pointer to the initialized list.
+ * 
+ * @post Nothing happens if the list is inactive or its first element is active.
+ * 
+ * @return This function does not return a value.
+ */
+void XDLL_DeleteBefore(XDLList *list) {
+
+    DLLElementPtr active = list->base.activeElement;
+    if (active == NULL || active->previousElement == NULL) {
+        return;
+    }
+
+    XDLL_Unlink(list, active->previousElement);
+    if (list->activePosition >= 0) {
+        list->activePosition--;
+    }
+}
+
+/**
+ * @brief Inserts a new element after the active one.
+ * 
+ * @param list Pointer to the initialized list.
+ * @param data Value to be inserted.
+ * 
+ * @post Nothing happens if the list is inactive. If the memory cannot be allocated,
+ *       DLL_Error is called and the list is unchanged.
+ * 
+ * @return This function does not return a value.
+ */
+void XDLL_InsertAfter(XDLList *list, int data) {
+
+    DLLElementPtr active = list->base.activeElement;
+    if (active != NULL) {
+        XDLL_LinkBetween(list, active, active->nextElement, data);
+    }
+}
+
+/**
+ * @brief Inserts a new element before the active one.
+ * 
+ * @param list Pointer to the initialized list.
+ * @param data Value to be inserted.
+ * 
+ * @post Nothing happens if the list is inactive. If the memory cannot be allocated,
+ *       DLL_Error is called and the list is unchanged.
+ * 
+ * @return This function does not return a value.
+ */
+void XDLL_InsertBefore(XDLList *list, int data) {
+
+    DLLElementPtr active = list->base.activeElement;
+    if (active == NULL) {
+        return;
+    }
+
+    if (XDLL_LinkBetween(list, active->previousElement, active, data) != NULL && list->activePosition >= 0) {
+        list->activePosition++;
+    }
+}
+
+/**
+ * @brief Retrieves the value of the active element.
+ * 
+ * @param list Pointer to the initialized list.
+ * @param dataPtr Pointer receiving the value.
+ * 
+ * @post If the list is inactive, DLL_Error is called.
+ * 
+ * @return This function does not return a value.
+ */
+void XDLL_GetValue(XDLList *list, int *dataPtr) {
+
+    DLL_GetValue(&list->base, dataPtr);
+}
+
+/**
+ * @brief Overwrites the value of the active element.
+ * 
+ * @param list Pointer to the initialized list.
+ * @param data New value.
+ * 
+ * @post Nothing happens if the list is inactive.
+ * 
+ * @return This function does not return a value.
+ */
+void XDLL_SetValue(XDLList *list, int data) {
+
+    DLL_SetValue(&list->base, data);
+}
+
+/**
+ * @brief Moves the activity to the next element.
+ * 
+ * @param list Pointer to the initialized list.
+ * 
+ * @post The activity is lost if the last element was active.
+ * 
+ * @return This function does not return a value.
+ */
+void XDLL_Next(XDLList *list) {
+
+    if (list->base.activeElement != NULL && list->activePosition >= 0) {
+        list->activePosition++;
+    }
+    DLL_Next(&list->base);
+}
+
+/**
+ * @brief Moves the activity to the previous element.
+ * 
+ * @param list Pointer to the initialized list.
+ * 
+ * @post The activity is lost if the first element was active.
+ * 
+ * @return This function does not return a value.
+ */
+void XDLL_Previous(XDLList *list) {
+
+    if (list->base.activeElement != NULL && list->activePosition >= 0) {
+        list->activePosition--;
+    }
+    DLL_Previous(&list->base);
+}
+
+/**
+ * @brief Checks whether the list is active.
+ * 
+ * @param list Pointer to the initialized list.
+ * 
+ * @retval int Nonzero if the list has an active element, 0 otherwise.
+ */
+int XDLL_IsActive(XDLList *list) {
+
+    return DLL_IsActive(&list->base);
+}
+
+/**
+ * @brief Returns the number of elements in the list.
+ * 
+ * @details The length is maintained by every insertion and deletion, so it is read in
+ *          constant time instead of being counted by a traversal.
+ * 
+ * @param list Pointer to the initialized doubly linked list structure.
+ * 
+ * @code
+ *   for (int i = XDLL_Length(&myList); i > 0; i--) {
+ *       XDLL_DeleteFirst(&myList);
+ *   }
+ * @endcode
+ * 
+ * @retval int Number of elements in the list.
+ */
+int XDLL_Length(XDLList *list) {
+
+    return list->length;
+}
+
+/**
+ * @brief Returns the position of the active element.
+ * 
+ * @details Positions are counted from zero at the first element. The position is kept
+ *          up to date by the operations that move the activity or insert and delete
+ *          elements in front of it, so it is normally read in constant time. Only after
+ *          an operation that cannot know how the position changed, the position is
+ *          recounted once by walking from the active element to the beginning.
+ * 
+ * @param list Pointer to the initialized doubly linked list structure.
+ * 
+ * @retval int Position of the active element, or -1 if the list is inactive.
+ */
+int XDLL_Position(XDLList *list) {
+
+    if (list->base.activeElement == NULL) {
+        return -1;
+    }
+
+    if (list->activePosition < 0) {
+        int position = 0;
+        for (DLLElementPtr element = list->base.activeElement->previousElement; element != NULL;
+             element = element->previousElement) {
+            position++;
+        }
+        list->activePosition = position;
+    }
+    return list->activePosition;
+}
+
+/**
+ * @brief Finds the element at a position by walking from the nearest known position.
+ * 
+ * @details The walk starts from whichever known position is closest to the target:
+ *          the first element, the last element, the active element or, with a seek
+ *          index, the nearer end of the run containing the target.
+ * 
+ * @param list Pointer to the initialized doubly linked list structure.
+ * @param position Position of the element, from 0 to the length of the list minus one.
+ * 
+ * @retval DLLElementPtr The element at 'position'.
+ */
+static DLLElementPtr XDLL_ElementAt(XDLList *list, int position) {
+
+    // Pick the nearest starting point
+    DLLElementPtr element = list->base.firstElement;
+    int current = 0;
+    if (list->length - 1 - position < position) {
+        element = list->base.lastElement;
+        current = list->length - 1;
+    }
+    DLLSeekIndex *index = list->seekIndex;
+    if (index != NULL) {
+        // Descend to the last sample at or before the position
+        DLLSeekNode *node = index->head;
+        int start = 0;
+        for (int level = index->levels - 1; level >= 0; level--) {
+            while (node->links[level].next != index->head && start + node->links[level].span <= position) {
+                start += node->links[level].span;
+                node = node->links[level].next;
+            }
+        }
+        DLLSeekNode *next = node->links[0].next;
+        int end = start + node->links[0].span;
+        if (next != index->head && end - position < position - start) {
+            if (end - position < abs(current - position)) {
+                element = next->element;
+                current = end;
+            }
+        } else if (position - start < abs(current - position)) {
+            element = node == index->head ? list->base.firstElement : node->element;
+            current = start;
+        }
+    }
+    if (list->base.activeElement != NULL && list->activePosition >= 0 &&
+        abs(list->activePosition - position) < abs(current - position)) {
+        element = list->base.activeElement;
+        current = list->activePosition;
+    }
+
+    for (; current < position; current++) {
+        element = element->nextElement;
+    }
+    for (; current > position; current--) {
+        element = element->previousElement;
+    }
+
+    return element;
+}
+
+/**
+ * @brief Makes the element at the given position active.
+ * 
+ * @details The walk starts from whichever known position is closest to the target:
+ *          the first element, the last element or the active element. Seeking near the
+ *          current activity or near either end of the list is therefore cheap, and no
+ *          seek walks more than half of the list. With a seek index enabled by
+ *          XDLL_SetSeekIndex, the seek descends the index in O(log n) steps and then
+ *          walks at most the stride of the index.
+ * 
+ * @param list Pointer to the initialized doubly linked list structure.
+ * @param position Position of the element to activate, counted from zero.
+ * 
+ * @post The element at 'position' is active. If the position is outside of the list,
+ *       the list becomes inactive, as it does when XDLL_Next leaves the last element.
+ * 
+ * @code
+ *   XDLL_Seek(&myList, XDLL_Length(&myList) / 2); // Activate the middle element
+ * @endcode
+ * 
+ * @return This function does not return a value.
+ */
+void XDLL_Seek(XDLList *list, int position) {
+
+    if (position < 0 || position >= list->length) {
+        list->base.activeElement = NULL;
+        return;
+    }
+
+    list->base.activeElement = XDLL_ElementAt(list, position);
+    list->activePosition = position;
+}
+
+/**
+ * @brief Lets XDLL_Seek find any position in O(log n) steps through a seek index.
+ * 
+ * @details The index samples elements of the list so that the runs of elements from
+ *          one sample to the next hold at most 2 * 'stride' elements and any two
+ *          neighbouring runs more than 'stride', and links the samples into a skip
+ *          list: every sample takes part
+ *          in the levels above the lowest with halving probability, and each link
+ *          counts the elements it jumps over. A seek descends the levels by these
+ *          counts to the run containing the position and walks at most 'stride' links
+ *          from the nearer end of the run.
+ * 
+ *          Every insertion and deletion updates the index in place: the changed run
+ *          is found by walking back to its sample, its counts are adjusted on each
+ *          level, and the run is split when it grows beyond twice the stride or merged
+ *          with a neighbour when both became short. A change thus costs O(log n) steps
+ *          in the index plus a walk of up to twice the stride, so seeks and edits can
+ *          be mixed freely. Splicing, splitting and concatenating visit the moved
+ *          elements once to count them into their new index; sorting, reversing and
+ *          compacting sample the list anew. A smaller stride means shorter walks and
+ *          more memory, about 80 bytes per run for its node and its hash table slots.
+ * 
+ * @param list Pointer to the initialized doubly linked list structure.
+ * @param stride Average number of elements per sample, or 0 to drop the index.
+ * 
+ * @post The index is released if 'stride' is 0 and built over the current elements
+ *       otherwise. XDLL_Dispose empties the index but keeps it. If the memory of the
+ *       index cannot be allocated, XDLL_Seek walks from the nearest known element as
+ *       without one; if a later node cannot be allocated, seeks into its run walk
+ *       further.
+ * 
+ * @code
+ *   XDLL_SetSeekIndex(&myList, 32);
+ *   for (int i = 0; i < queries; i++) {
+ *       XDLL_Seek(&myList, positions[i]);      // At most 32 steps after the descent
+ *       XDLL_InsertAfter(&myList, values[i]);  // The index stays up to date
+ *   }
+ * @endcode
+ * 
+ * @return This function does not return a value.
+ */
+void XDLL_SetSeekIndex(XDLList *list, int stride) {
+
+    DLLSeekIndex *index = list->seekIndex;
+    if (stride <= 0) {
+        if (index != NULL) {
+            XDLL_SeekClear(index);
+            free(index->head);
+            free(index->table);
+            free(index);
+            list->seekIndex = NULL;
+        }
+        return;
+    }
+
+    if (index == NULL) {
+        enum { INITIAL_CAPACITY = 16 };
+        index = (DLLSeekIndex *) malloc(sizeof(DLLSeekIndex));
+        DLLSeekNode *head = (DLLSeekNode *) malloc(sizeof(DLLSeekNode) + sizeof(DLLSeekLink) * DLL_SEEK_LEVELS);
+        DLLSeekNode **table = (DLLSeekNode **) calloc(INITIAL_CAPACITY, sizeof(DLLSeekNode *));
+        if (index == NULL || head == NULL || table == NULL) {
+            free(index);
+            free(head);
+            free(table);
+            return;
+        }
+        head->element = NULL;
+        head->levels = DLL_SEEK_LEVELS;
+        head->links[0].next = head;
+        index->head = head;
+        index->table = table;
+        index->capacity = INITIAL_CAPACITY;
+        index->count = 0;
+        index->random = 2463534242u;
+        list->seekIndex = index;
+    }
+    index->stride = stride;
+    XDLL_SeekRebuild(list);
+}
+
+/**
+ * @brief Initializes a cursor and registers it with a list.
+ * 
+ * @details A cursor is a position in the list of its own, independent of the list's
+ *          active element and of the other cursors, so any number of scans and edits
+ *          can share one list. The cursor operations mirror the operations on the active
+ *          element. Cursors are not thread-safe; they allow interleaved use of one list,
+ *          not simultaneous use from several threads.
+ * 
+ *          Whenever an element is removed from the list, by whatever operation, every
+ *          cursor pointing at it becomes inactive, exactly as the list becomes inactive
+ *          when its active element is deleted. A cursor therefore never refers to freed
+ *          memory. The only exception is XDLL_CursorDelete, which moves the deleting
+ *          cursor to the following element.
+ * 
+ * @param cursor Pointer to the cursor structure to be initialized.
+ * @param list Pointer to the initialized list the cursor will walk.
+ * 
+ * @post The cursor is inactive and registered with the list. It stays registered across
+ *       XDLL_Dispose and must be released by XDLL_CursorDispose before the list itself
+ *       goes out of scope.
+ * 
+ * @code
+ *   XDLLCursor reader, writer;
+ *   XDLL_CursorInit(&reader, &myList);
+ *   XDLL_CursorInit(&writer, &myList);
+ *   for (XDLL_CursorFirst(&reader); XDLL_CursorIsActive(&reader); XDLL_CursorNext(&reader)) {
+ *       // [Read with XDLL_CursorGetValue(&reader, ...), edit through the writer]
+ *   }
+ *   XDLL_CursorDispose(&writer);
+ *   XDLL_CursorDispose(&reader);
+ * @endcode
+ * 
+ * @return This function does not return a value.
+ */
+void XDLL_CursorInit(XDLLCursor *cursor, XDLList *list) {
+
+    cursor->list = list;
+    cursor->element = NULL;
+    cursor->previousCursor = NULL;
+    cursor->nextCursor = list->cursors;
+    if (list->cursors != NULL) {
+        list->cursors->previousCursor = cursor;
+    }
+    list->cursors = cursor;
+}
+
+/**
+ * @brief Unregisters a cursor from its list.
+ * 
+ * @param cursor Pointer to the initialized cursor.
+ * 
+ * @post The list no longer tracks the cursor, which must be initialized again before
+ *       further use.
+ * 
+ * @return This function does not return a value.
+ */
+void XDLL_CursorDispose(XDLLCursor *cursor) {
+
+    if (cursor->previousCursor != NULL) {
+        cursor->previousCursor->nextCursor = cursor->nextCursor;
+    } else {
+        cursor->list->cursors = cursor->nextCursor;
+    }
+    if (cursor->nextCursor != NULL) {
+        cursor->nextCursor->previousCursor = cursor->previousCursor;
+    }
+    cursor->list = NULL;
+    cursor->element = NULL;
+    cursor->previousCursor = NULL;
+    cursor->nextCursor = NULL;
+}
+
+/**
+ * @brief Moves the cursor to the first element of its list.
+ * 
+ * @param cursor Pointer to the initialized cursor.
+ * 
+ * @post The cursor points at the first element, or is inactive if the list is empty.
+ * 
+ * @return This function does not return a value.
+ */
+void XDLL_CursorFirst(XDLLCursor *cursor) {
+
+    cursor->element = cursor->list->base.firstElement;
+}
+
+/**
+ * @brief Moves the cursor to the last element of its list.
+ * 
+ * @param cursor Pointer to the initialized cursor.
+ * 
+ * @post The cursor points at the last element, or is inactive if the list is empty.
+ * 
+ * @return This function does not return a value.
+ */
+void XDLL_CursorLast(XDLLCursor *cursor) {
+
+    cursor->element = cursor->list->base.lastElement;
+}
+
+/**
+ * @brief Moves the cursor to the next element.
+ * 
+ * @param cursor Pointer to the initialized cursor.
+ * 
+ * @post The cursor points at the next element. Leaving the last element makes the
+ *       cursor inactive. An inactive cursor stays inactive.
+ * 
+ * @return This function does not return a value.
+ */
+void XDLL_CursorNext(XDLLCursor *cursor) {
+
+    if (cursor->element != NULL) {
+        cursor->element = cursor->element->nextElement;
+    }
+}
+
+/**
+ * @brief Moves the cursor to the previous element.
+ * 
+ * @param cursor Pointer to the initialized cursor.
+ * 
+ * @post The cursor points at the previous element. Leaving the first element makes the
+ *       cursor inactive. An inactive cursor stays inactive.
+ * 
+ * @return This function does not return a value.
+ */
+void XDLL_CursorPrevious(XDLLCursor *cursor) {
+
+    if (cursor->element != NULL) {
+        cursor->element = cursor->element->previousElement;
+    }
+}
+
+/**
+ * @brief Checks whether the cursor points at an element.
+ * 
+ * @param cursor Pointer to the initialized cursor.
+ * 
+ * @retval int Nonzero if the cursor is active, 0 otherwise.
+ */
+int XDLL_CursorIsActive(XDLLCursor *cursor) {
+
+    return cursor->element != NULL;
+}
+
+/**
+ * @brief Retrieves the value of the element under the cursor.
+ * 
+ * @param cursor Pointer to the initialized cursor.
+ * @param dataPtr Pointer to the variable receiving the value.
+ * 
+ * @post If the cursor is inactive, DLL_Error is called and '*dataPtr' is unchanged.
+ * 
+ * @return This function does not return a value.
+ */
+void XDLL_CursorGetValue(XDLLCursor *cursor, int *dataPtr) {
+
+    if (cursor->element == NULL) {
+        DLL_Error();
+        return;
+    }
+    *dataPtr = cursor->element->data;
+}
+
+/**
+ * @brief Overwrites the value of the element under the cursor.
+ * 
+ * @param cursor Pointer to the initialized cursor.
+ * @param data New value of the element.
+ * 
+ * @post The element holds 'data'. Nothing happens if the cursor is inactive.
+ * 
+ * @return This function does not return a value.
+ */
+void XDLL_CursorSetValue(XDLLCursor *cursor, int data) {
+
+    if (cursor->element != NULL) {
+        cursor->element->data = data;
+    }
+}
+
+/**
+ * @brief Inserts a new element after the element under the cursor.
+ * 
+ * @param cursor Pointer to the initialized cursor.
+ * @param data Value of the new element.
+ * 
+ * @post The new element follows the cursor's element; the cursor does not move. Nothing
+ *       happens if the cursor is inactive. If the memory cannot be allocated, DLL_Error
+ *       is called and the list is unchanged.
+ * 
+ * @return This function does not return a value.
+ */
+void XDLL_CursorInsertAfter(XDLLCursor *cursor, int data) {
+
+    if (cursor->element == NULL) {
+        return;
+    }
+
+    XDLList *list = cursor->list;
+    if (XDLL_LinkBetween(list, cursor->element, cursor->element->nextElement, data) != NULL &&
+        list->base.activeElement != cursor->element) {
+        // The new element may lie in front of the active one
+        list->activePosition = -1;
+    }
+}
+
+/**
+ * @brief Inserts a new element before the element under the cursor.
+ * 
+ * @param cursor Pointer to the initialized cursor.
+ * @param data Value of the new element.
+ * 
+ * @post The new element precedes the cursor's element; the cursor does not move.
+ *       Nothing happens if the cursor is inactive. If the memory cannot be allocated,
+ *       DLL_Error is called and the list is unchanged.
+ * 
+ * @return This function does not return a value.
+ */
+void XDLL_CursorInsertBefore(XDLLCursor *cursor, int data) {
+
+    if (cursor->element == NULL) {
+        return;
+    }
+
+    XDLList *list = cursor->list;
+    if (XDLL_LinkBetween(list, cursor->element->previousElement, cursor->element, data) != NULL) {
+        if (list->base.activeElement == cursor->element) {
+            if (list->activePosition >= 0) {
+                list->activePosition++;
+            }
+        } else {
+            list->activePosition = -1;
+        }
+    }
+}
+
+/**
+ * @brief Deletes the element under the cursor and moves the cursor to the next one.
+ * 
+ * @details Advancing instead of deactivating lets a single forward scan filter the list:
+ *          the loop body either deletes the element or calls XDLL_CursorNext. All other
+ *          cursors on the deleted element become inactive, and so does the list if the
+ *          element was its active one.
+ * 
+ * @param cursor Pointer to the initialized cursor.
+ * 
+ * @post The element is removed and the cursor points at its successor, or is inactive
+ *       if the last element was deleted. Nothing happens if the cursor is inactive.
+ * 
+ * @code
+ *   XDLL_CursorFirst(&cursor);
+ *   while (XDLL_CursorIsActive(&cursor)) {
+ *       int value;
+ *       XDLL_CursorGetValue(&cursor, &value);
+ *       if (value < 0) {
+ *           XDLL_CursorDelete(&cursor);   // Drop negative values
+ *       } else {
+ *           XDLL_CursorNext(&cursor);
+ *       }
+ *   }
+ * @endcode
+ * 
+ * @return This function does not return a value.
+ */
+void XDLL_CursorDelete(XDLLCursor *cursor) {
+
+    DLLElementPtr element = cursor->element;
+    if (element == NULL) {
+        return;
+    }
+
+    XDLList *list = cursor->list;
+    DLLElementPtr next = element->nextElement;
+    if (list->base.activeElement != element) {
+        // The deleted element may lie in front of the active one
+        list->activePosition = -1;
+    }
+    XDLL_Unlink(list, element);
+    cursor->element = next;
+}
+
+/**
+ * @brief Merges two sorted chains linked through their next pointers.
+ * 
+ * @param first Chain whose elements come first among equal values.
+ * @param second Chain of the elements that follow 'first' in the original order.
+ * 
+ * @retval DLLElementPtr Head of the merged chain, whose previous pointers are not set.
+ */
+static DLLElementPtr XDLL_MergeChains(DLLElementPtr first, DLLElementPtr second) {
+
+    struct DLLElement head;
+    DLLElementPtr tail = &head;
+    while (first != NULL && second != NULL) {
+        if (second->data < first->data) {
+            tail->nextElement = second;
+            second = second->nextElement;
+        } else {
+            tail->nextElement = first;
+            first = first->nextElement;
+        }
+        tail = tail->nextElement;
+    }
+    tail->nextElement = first != NULL ? first : second;
+    return head.nextElement;
+}
+
+/**
+ * @brief Installs a chain linked through its next pointers as the list's contents.
+ * 
+ * @param list Pointer to the initialized doubly linked list structure.
+ * @param chain Head of a chain holding exactly the elements of the list.
+ * 
+ * @post The previous pointers, the first and the last element are set. The active
+ *       element and the cursors stay on their elements, whose position is unknown.
+ */
+static void XDLL_RelinkChain(XDLList *list, DLLElementPtr chain) {
+
+    DLLElementPtr previous = NULL;
+    list->base.firstElement = chain;
+    for (DLLElementPtr element = chain; element != NULL; element = element->nextElement) {
+        element->previousElement = previous;
+        previous = element;
+    }
+    list->base.lastElement = previous;
+    list->activePosition = -1;
+    XDLL_SeekRebuild(list);
+}
+
+/**
+ * @brief Sorts the list in ascending order by relinking its elements.
+ * 
+ * @details A bottom-up merge sort: elements are taken one at a time and merged into
+ *          a stack of sorted runs where the run at level k holds 2^k elements, like
+ *          carrying in a binary counter. Only the next pointers are used while sorting
+ *          and the previous pointers are restored in a final pass. The sort needs
+ *          O(n log n) comparisons, no recursion and no memory beyond a fixed array of
+ *          run heads, and no element is allocated, freed or copied.
+ * 
+ * @param list Pointer to the initialized doubly linked list structure.
+ * 
+ * @post The values are in ascending order and equal values keep their relative order
+ *       (the sort is stable). The active element and the cursors stay on the same
+ *       elements, which have moved.
+ * 
+ * @code
+ *   XDLL_Sort(&myList);
+ *   XDLL_GetFirst(&myList, &smallest);
+ * @endcode
+ * 
+ * @return This function does not return a value.
+ */
+void XDLL_Sort(XDLList *list) {
+
+    // runs[k] is empty or a sorted run of 2^k elements older than those in runs[k - 1]
+    DLLElementPtr runs[sizeof(size_t) * 8] = { NULL };
+    int levels = 0;
+
+    DLLElementPtr element = list->base.firstElement;
+    while (element != NULL) {
+        DLLElementPtr run = element;
+        element = element->nextElement;
+        run->nextElement = NULL;
+
+        int level = 0;
+        for (; runs[level] != NULL; level++) {
+            run = XDLL_MergeChains(runs[level], run);
+            runs[level] = NULL;
+        }
+        runs[level] = run;
+        if (level >= levels) {
+            levels = level + 1;
+        }
+    }
+
+    DLLElementPtr sorted = NULL;
+    for (int level = 0; level < levels; level++) {
+        if (runs[level] != NULL) {
+            sorted = XDLL_MergeChains(runs[level], sorted);
+        }
+    }
+    XDLL_RelinkChain(list, sorted);
+}
+
+/**
+ * @brief Sorts the list in ascending order by distributing its elements by bytes.
+ * 
+ * @details A least significant digit radix sort for the int payload. Every pass
+ *          distributes the elements into 256 bucket chains by one byte of the value,
+ *          with the sign bit flipped so that negative values come first, and then
+ *          concatenates the chains. A counting pass ahead finds the bytes in which all
+ *          values agree, and their passes are skipped, so lists of small or similar
+ *          values take fewer than four passes. The sort is linear in the length of
+ *          the list and, like XDLL_Sort, only relinks elements.
+ * 
+ * @param list Pointer to the initialized doubly linked list structure.
+ * 
+ * @post The values are in ascending order and equal values keep their relative order.
+ *       The active element and the cursors stay on the same elements.
+ * 
+ * @note Each pass visits the elements in list order, so on long lists whose elements
+ *       are scattered in memory XDLL_Sort can be faster despite more comparisons.
+ * 
+ * @return This function does not return a value.
+ */
+void XDLL_RadixSort(XDLList *list) {
+
+    enum { RADIX_BITS = 8, BUCKETS = 1 << RADIX_BITS, PASSES = sizeof(int) * 8 / RADIX_BITS };
+    static const unsigned SIGN_BIT = 1u << (sizeof(int) * 8 - 1);
+
+    if (list->base.firstElement == NULL) {
+        return;
+    }
+
+    // A byte position needs a pass only if the values differ in it
+    unsigned firstKey = (unsigned) list->base.firstElement->data ^ SIGN_BIT;
+    unsigned differing = 0;
+    for (DLLElementPtr element = list->base.firstElement; element != NULL; element = element->nextElement) {
+        differing |= ((unsigned) element->data ^ SIGN_BIT) ^ firstKey;
+    }
+
+    DLLElementPtr chain = list->base.firstElement;
+    for (int pass = 0; pass < PASSES; pass++) {
+        int shift = pass * RADIX_BITS;
+        if (((differing >> shift) & (BUCKETS - 1)) == 0) {
+            continue;
+        }
+
+        DLLElementPtr heads[BUCKETS] = { NULL };
+        DLLElementPtr tails[BUCKETS];
+        for (DLLElementPtr element = chain; element != NULL; element = element->nextElement) {
+            unsigned bucket = (((unsigned) element->data ^ SIGN_BIT) >> shift) & (BUCKETS - 1);
+            if (heads[bucket] == NULL) {
+                heads[bucket] = element;
+            } else {
+                tails[bucket]->nextElement = element;
+            }
+            tails[bucket] = element;
+        }
+
+        // Concatenate the buckets in order
+        DLLElementPtr *link = &chain;
+        for (int bucket = 0; bucket < BUCKETS; bucket++) {
+            if (heads[bucket] != NULL) {
+                *link = heads[bucket];
+                link = &tails[bucket]->nextElement;
+            }
+        }
+        *link = NULL;
+    }
+    XDLL_RelinkChain(list, chain);
+}
+
+/**
+ * @brief Deactivates all cursors registered with a list.
+ * 
+ * @details Used after moving an unknown part of the list into another list, when the
+ *          cursors on the moved elements cannot be told from the others without a walk.
+ * 
+ * @param list Pointer to the initialized doubly linked list structure.
+ */
+static void XDLL_DeactivateCursors(XDLList *list) {
+
+    for (XDLLCursor *cursor = list->cursors; cursor != NULL; cursor = cursor->nextCursor) {
+        cursor->element = NULL;
+    }
+}
+
+/**
+ * @brief Appends the whole chain of one list to the end of another.
+ * 
+ * @details The chains are joined by relinking the two elements where they meet, so no
+ *          element is allocated or freed, and none is visited unless 'target' has a
+ *          seek index, which then counts the appended elements in. The cursors of
+ *          'source' move with their elements and are registered with 'target'
+ *          afterwards.
+ * 
+ * @param target Pointer to the initialized list receiving the elements.
+ * @param source Pointer to the initialized list giving its elements away.
+ * 
+ * @pre Both lists use the same pool, or no pool at all, because deleting an element
+ *      later returns it to the allocator of the list holding it.
+ * 
+ * @post 'source' is empty and inactive; 'target' keeps its active element. If the
+ *       lists differ in their pools or are the same list, DLL_Error is called and
+ *       nothing changes.
+ * 
+ * @code
+ *   XDLL_Concat(&all, &batch); // batch is empty now
+ * @endcode
+ * 
+ * @return This function does not return a value.
+ */
+void XDLL_Concat(XDLList *target, XDLList *source) {
+
+    if (target == source || target->pool != source->pool) {
+        DLL_Error();
+        return;
+    }
+    if (source->base.firstElement == NULL) {
+        return;
+    }
+
+    if (target->base.lastElement != NULL) {
+        target->base.lastElement->nextElement = source->base.firstElement;
+        source->base.firstElement->previousElement = target->base.lastElement;
+    } else {
+        target->base.firstElement = source->base.firstElement;
+    }
+    target->base.lastElement = source->base.lastElement;
+    target->length += source->length;
+    XDLL_SeekInserted(target, source->base.firstElement, source->length);
+    if (source->seekIndex != NULL) {
+        XDLL_SeekClear(source->seekIndex);
+    }
+
+    // Hand the cursors over, they stay on their elements
+    XDLLCursor *cursor = source->cursors;
+    while (cursor != NULL) {
+        XDLLCursor *next = cursor->nextCursor;
+        cursor->previousCursor = NULL;
+        cursor->nextCursor = target->cursors;
+        if (target->cursors != NULL) {
+            target->cursors->previousCursor = cursor;
+        }
+        target->cursors = cursor;
+        cursor->list = target;
+        cursor = next;
+    }
+
+    source->base.firstElement = NULL;
+    source->base.lastElement = NULL;
+    source->base.activeElement = NULL;
+    source->length = 0;
+    source->activePosition = -1;
+    source->cursors = NULL;
+}
+
+/**
+ * @brief Moves the elements between two cursors behind the active element of a list.
+ * 
+ * @details The range from the element of 'first' to the element of 'last', both
+ *          included, is cut out of the cursors' list and linked in behind the active
+ *          element of 'target' with four pointer updates at each end. The range is
+ *          walked once to check that 'last' follows 'first' and to count the moved
+ *          elements for XDLL_Length; the walk reads only next pointers, payloads are
+ *          not touched. Seek indexes of the lists visit the range once more.
+ * 
+ * @param target Pointer to the initialized list receiving the elements. It must be
+ *               active, or empty, in which case the range becomes its whole content.
+ * @param first Cursor on the first element of the range.
+ * @param last Cursor on the last element of the range, in the same list as 'first'.
+ * 
+ * @pre The lists use the same pool, or no pool at all.
+ * 
+ * @post The range follows the active element of 'target', whose activity and cursors
+ *       are unchanged. All cursors of the source list, 'first' and 'last' included,
+ *       are deactivated, and so is the source list if its active element moved. If
+ *       'target' is neither active nor empty, nothing happens. If the cursors are
+ *       inactive, belong to different lists or to 'target', or do not delimit
+ *       a range, or the pools differ, DLL_Error is called and nothing changes.
+ * 
+ * @code
+ *   // Move the elements from cursor a to cursor b behind the active element of other
+ *   XDLL_SpliceRange(&other, &a, &b);
+ * @endcode
+ * 
+ * @return This function does not return a value.
+ */
+void XDLL_SpliceRange(XDLList *target, XDLLCursor *first, XDLLCursor *last) {
+
+    XDLList *source = first->list;
+    if (first->element == NULL || last->element == NULL || last->list != source ||
+        source == target || source->pool != target->pool) {
+        DLL_Error();
+        return;
+    }
+    if (target->base.activeElement == NULL && target->base.firstElement != NULL) {
+        return;
+    }
+
+    // Check the order of the cursors and count the range
+    int count = 1;
+    int containsActive = first->element == source->base.activeElement;
+    DLLElementPtr element = first->element;
+    for (; element != last->element && element != NULL; element = element->nextElement) {
+        count++;
+        containsActive |= element->nextElement == source->base.activeElement;
+    }
+    if (element == NULL) {
+        DLL_Error();
+        return;
+    }
+
+    // Cut the range out of the source
+    DLLElementPtr rangeFirst = first->element;
+    DLLElementPtr rangeLast = last->element;
+    XDLL_SeekRemoved(source, rangeFirst, rangeLast);
+    if (rangeFirst->previousElement != NULL) {
+        rangeFirst->previousElement->nextElement = rangeLast->nextElement;
+    } else {
+        source->base.firstElement = rangeLast->nextElement;
+    }
+    if (rangeLast->nextElement != NULL) {
+        rangeLast->nextElement->previousElement = rangeFirst->previousElement;
+    } else {
+        source->base.lastElement = rangeFirst->previousElement;
+    }
+    source->length -= count;
+    if (containsActive) {
+        source->base.activeElement = NULL;
+    }
+    source->activePosition = -1;
+    XDLL_DeactivateCursors(source);
+
+    // Link it in behind the active element of the target
+    DLLElementPtr previous = target->base.activeElement;
+    DLLElementPtr next = previous != NULL ? previous->nextElement : NULL;
+    rangeFirst->previousElement = previous;
+    rangeLast->nextElement = next;
+    if (previous != NULL) {
+        previous->nextElement = rangeFirst;
+    } else {
+        target->base.firstElement = rangeFirst;
+    }
+    if (next != NULL) {
+        next->previousElement = rangeLast;
+    } else {
+        target->base.lastElement = rangeLast;
+    }
+    target->length += count;
+    XDLL_SeekInserted(target, rangeFirst, count);
+}
+
+/**
+ * @brief Moves the elements behind the active element to the end of another list.
+ * 
+ * @details The list is cut behind its active element and the cut-off part is appended
+ *          to 'tail' by relinking the elements at both joints. The number of moved
+ *          elements follows from the position of the active element, which is known in
+ *          constant time unless an earlier operation invalidated it. Seek indexes of
+ *          the lists visit the moved elements once.
+ * 
+ * @param list Pointer to the initialized list to be split.
+ * @param tail Pointer to the initialized list receiving the elements, usually empty.
+ * 
+ * @pre The lists use the same pool, or no pool at all.
+ * 
+ * @post The active element is the last element of 'list', and 'tail' ends with the
+ *       elements that followed it. The cursors of 'list' are deactivated. Nothing
+ *       happens if 'list' is inactive. If the pools differ or the lists are the same,
+ *       DLL_Error is called and nothing changes.
+ * 
+ * @code
+ *   XDLL_Seek(&myList, XDLL_Length(&myList) / 2 - 1);
+ *   XDLL_Split(&myList, &secondHalf);
+ * @endcode
+ * 
+ * @return This function does not return a value.
+ */
+void XDLL_Split(XDLList *list, XDLList *tail) {
+
+    if (list == tail || list->pool != tail->pool) {
+        DLL_Error();
+        return;
+    }
+    DLLElementPtr active = list->base.activeElement;
+    if (active == NULL || active->nextElement == NULL) {
+        return;
+    }
+
+    int count = list->length - 1 - XDLL_Position(list);
+    DLLElementPtr moved = active->nextElement;
+    XDLL_SeekRemoved(list, moved, list->base.lastElement);
+
+    if (tail->base.lastElement != NULL) {
+        tail->base.lastElement->nextElement = moved;
+    } else {
+        tail->base.firstElement = moved;
+    }
+    moved->previousElement = tail->base.lastElement;
+    tail->base.lastElement = list->base.lastElement;
+    tail->length += count;
+
+    active->nextElement = NULL;
+    list->base.lastElement = active;
+    list->length -= count;
+    XDLL_SeekInserted(tail, moved, count);
+    XDLL_DeactivateCursors(list);
+}
+
+/**
+ * @brief Reverses the order of the elements.
+ * 
+ * @details Swaps the two links of every element and the first and last element of
+ *          the list. The elements stay in place and keep their payloads.
+ * 
+ * @param list Pointer to the initialized doubly linked list structure.
+ * 
+ * @post The list holds its values in reverse order. The active element and the
+ *       cursors stay on the same elements, and a known active position is mirrored.
+ * 
+ * @note The reversal takes time linear in the length of the list. A constant-time
+ *       reversal would need a direction flag that every operation consults, but the
+ *       base DLList is also walked directly through its firstElement and nextElement
+ *       pointers, and by the DLL_* operations, which would then silently run in the
+ *       wrong direction.
+ * 
+ * @return This function does not return a value.
+ */
+void XDLL_Reverse(XDLList *list) {
+
+    DLLElementPtr element = list->base.firstElement;
+    while (element != NULL) {
+        DLLElementPtr next = element->nextElement;
+        element->nextElement = element->previousElement;
+        element->previousElement = next;
+        element = next;
+    }
+
+    element = list->base.firstElement;
+    list->base.firstElement = list->base.lastElement;
+    list->base.lastElement = element;
+    XDLL_SeekRebuild(list);
+    if (list->activePosition >= 0) {
+        list->activePosition = list->length - 1 - list->activePosition;
+    }
+}
+
+/**
+ * @brief Appends the values of an array to the end of the list.
+ * 
+ * @details All elements are obtained and linked into a chain before the chain is
+ *          attached to the list in one step. A pooled list first makes sure that its
+ *          pool holds enough free elements, allocating one slab of exactly 'count'
+ *          elements if it does not, so the whole array costs at most one malloc and
+ *          the new elements lie next to each other in memory in list order. A list
+ *          without a pool still calls malloc once per element.
+ * 
+ * @param list Pointer to the initialized doubly linked list structure.
+ * @param values Values to append, in order.
+ * @param count Number of values.
+ * 
+ * @post The values are the last elements of the list and the active element is
+ *       unchanged. If the memory cannot be allocated, DLL_Error is called and the
+ *       list is unchanged.
+ * 
+ * @code
+ *   int values[] = { 1, 2, 3 };
+ *   XDLL_InsertLastN(&myList, values, 3);
+ * @endcode
+ * 
+ * @return This function does not return a value.
+ */
+void XDLL_InsertLastN(XDLList *list, const int *values, int count) {
+
+    if (count <= 0) {
+        return;
+    }
+    DLLPool *pool = list->pool;
+    if (pool != NULL && pool->freeCount < (size_t) count && !DLLPool_AddSlab(pool, (size_t) count)) {
+        DLL_Error();
+        return;
+    }
+
+    struct DLLElement head;
+    DLLElementPtr tail = &head;
+    for (int i = 0; i < count; i++) {
+        DLLElementPtr element = XDLL_AllocElement(list);
+        if (element == NULL) {
+            // Only a list without a pool gets here, give back what was allocated
+            tail->nextElement = NULL;
+            while (head.nextElement != NULL) {
+                element = head.nextElement;
+                head.nextElement = element->nextElement;
+                free(element);
+            }
+            DLL_Error();
+            return;
+        }
+        element->data = values[i];
+        element->previousElement = tail;
+        tail->nextElement = element;
+        tail = element;
+    }
+
+    // Attach the chain behind the last element
+    DLLElementPtr first = head.nextElement;
+    first->previousElement = list->base.lastElement;
+    tail->nextElement = NULL;
+    if (list->base.lastElement != NULL) {
+        list->base.lastElement->nextElement = first;
+    } else {
+        list->base.firstElement = first;
+    }
+    list->base.lastElement = tail;
+    list->length += count;
+    XDLL_SeekInserted(list, first, count);
+}
+
+/**
+ * @brief Replaces the contents of the list with the values of an array.
+ * 
+ * @param list Pointer to the initialized doubly linked list structure.
+ * @param values Values of the new elements, in order.
+ * @param count Number of values.
+ * 
+ * @post The list holds exactly the values and is inactive. A pooled list reuses the
+ *       elements it held before. If the memory cannot be allocated, DLL_Error is
+ *       called and the list is empty.
+ * 
+ * @return This function does not return a value.
+ */
+void XDLL_FromArray(XDLList *list, const int *values, int count) {
+
+    XDLL_Dispose(list);
+    XDLL_InsertLastN(list, values, count);
+}
+
+/**
+ * @brief Copies the values of the list into an array.
+ * 
+ * @param list Pointer to the initialized doubly linked list structure.
+ * @param buffer Array receiving the values in list order.
+ * @param capacity Number of elements of 'buffer'.
+ * 
+ * @retval int Number of values copied, the smaller of the length and 'capacity'.
+ */
+int XDLL_ToArray(XDLList *list, int *buffer, int capacity) {
+
+    int count = 0;
+    for (DLLElementPtr element = list->base.firstElement; element != NULL && count < capacity;
+         element = element->nextElement) {
+        buffer[count++] = element->data;
+    }
+    return count;
+}
+
+/**
+ * @brief Copies the values of a range of positions into an array.
+ * 
+ * @details The first element of the range is found like in XDLL_Seek, from the nearest
+ *          of the first, last and active elements, and the active element is left alone.
+ * 
+ * @param list Pointer to the initialized doubly linked list structure.
+ * @param position Position of the first value to copy, counted from zero.
+ * @param count Number of values to copy.
+ * @param buffer Array of at least 'count' elements receiving the values in list order.
+ * 
+ * @retval int Number of values copied, fewer than 'count' if the range reaches past the
+ *             end of the list, and zero if 'position' is outside of the list.
+ */
+int XDLL_RangeToArray(XDLList *list, int position, int count, int *buffer) {
+
+    if (position < 0 || position >= list->length) {
+        return 0;
+    }
+    int copied = 0;
+    for (DLLElementPtr element = XDLL_ElementAt(list, position); element != NULL && copied < count;
+         element = element->nextElement) {
+        buffer[copied++] = element->data;
+    }
+    return copied;
+}
+
+/**
+ * @brief Measures how scattered the elements of the list are in memory.
+ * 
+ * @details A link counts as local when the next element starts at most one cache line
+ *          (64 bytes) after the current one, which is the case for elements allocated
+ *          one after another from a slab or from fresh malloc memory. Following a local
+ *          link rarely misses the cache, following any other link usually does.
+ * 
+ * @param list Pointer to the initialized doubly linked list structure.
+ * 
+ * @retval double Fraction of the links between neighbours that are not local, from 0
+ *                for a list laid out in order to 1 for a fully scattered one.
+ */
+double XDLL_Fragmentation(XDLList *list) {
+
+    if (list->length < 2) {
+        return 0;
+    }
+
+    int scattered = 0;
+    for (DLLElementPtr element = list->base.firstElement; element->nextElement != NULL;
+         element = element->nextElement) {
+        uintptr_t here = (uintptr_t) element;
+        uintptr_t next = (uintptr_t) element->nextElement;
+        if (next <= here || next - here > 64) {
+            scattered++;
+        }
+    }
+    return (double) scattered / (list->length - 1);
+}
+
+/**
+ * @brief Moves the elements to fresh memory laid out in list order.
+ * 
+ * @details A pooled list obtains one new slab holding exactly its length from the pool,
+ *          copies the values into it in list order, gives all old elements back to the
+ *          pool at once and lets DLLPool_Trim release the slabs that are left unused.
+ * 
+ *          A list without a pool frees its elements one by one, so they cannot share a
+ *          block. It allocates the new elements one by one before any old element is
+ *          freed and only re-orders the list in allocation order; whether the copies
+ *          are also adjacent in memory is up to malloc. Lists that need the layout
+ *          should use a pool.
+ * 
+ *          While copying, every old element keeps a pointer to its replacement in its
+ *          previous pointer, which is used to move the active element and the cursors.
+ * 
+ * @param list Pointer to the initialized doubly linked list structure.
+ * 
+ * @post The list holds the same values in the same order and the active element and the
+ *       cursors are on the copies of their elements. Pointers to elements kept outside
+ *       of the list and its cursors are dangling. If the memory cannot be allocated,
+ *       DLL_Error is called and the list is unchanged.
+ * 
+ * @note The old slabs are only released once no list uses any of their elements, so in
+ *       a pool shared with other lists a compaction may leave the pool larger by up to
+ *       the length of the list. Repeated compactions do not grow it further, since each
+ *       one releases the slab the previous one allocated.
+ * 
+ * @return This function does not return a value.
+ */
+void XDLL_Compact(XDLList *list) {
+
+    if (list->length == 0) {
+        return;
+    }
+    DLLPool *pool = list->pool;
+    if (pool != NULL && !DLLPool_AddSlab(pool, (size_t) list->length)) {
+        DLL_Error();
+        return;
+    }
+
+    // Copy in list order, leaving a forward pointer in each old element
+    DLLElementPtr previous = NULL;
+    DLLElementPtr first = NULL;
+    for (DLLElementPtr old = list->base.firstElement; old != NULL; old = old->nextElement) {
+        DLLElementPtr element = pool != NULL ? XDLL_AllocElement(list) : (DLLElementPtr) malloc(sizeof(struct DLLElement));
+        if (element == NULL) {
+            // Only a list without a pool gets here, undo the copies made so far
+            for (DLLElementPtr copy = first; copy != NULL; copy = first) {
+                first = copy->nextElement;
+                free(copy);
+            }
+            previous = NULL;
+            for (DLLElementPtr original = list->base.firstElement; original != NULL; original = original->nextElement) {
+                original->previousElement = previous;
+                previous = original;
+            }
+            DLL_Error();
+            return;
+        }
+        element->data = old->data;
+        element->previousElement = previous;
+        element->nextElement = NULL;
+        if (previous != NULL) {
+            previous->nextElement = element;
+        } else {
+            first = element;
+        }
+        previous = element;
+        old->previousElement = element;
+    }
+
+    if (list->base.activeElement != NULL) {
+        list->base.activeElement = list->base.activeElement->previousElement;
+    }
+    for (XDLLCursor *cursor = list->cursors; cursor != NULL; cursor = cursor->nextCursor) {
+        if (cursor->element != NULL) {
+            cursor->element = cursor->element->previousElement;
+        }
+    }
+
+    // Release the old elements without the per-element cursor check of XDLL_FreeElement
+    if (pool != NULL) {
+        list->base.lastElement->nextElement = pool->freeElements;
+        pool->freeElements = list->base.firstElement;
+        pool->freeCount += list->length;
+        DLLPool_Trim(pool);
+    } else {
+        DLLElementPtr old = list->base.firstElement;
+        while (old != NULL) {
+            DLLElementPtr next = old->nextElement;
+            free(old);
+            old = next;
+        }
+    }
+
+    list->base.firstElement = first;
+    list->base.lastElement = previous;
+    list->churn = 0;
+    XDLL_SeekRebuild(list);
+}
+
+/**
+ * @brief Sets the fragmentation above which XDLL_MaybeCompact compacts the list.
+ * 
+ * @details Once a threshold is set, allocations and frees of elements are counted, so
+ *          that XDLL_MaybeCompact can tell when measuring the fragmentation is worth it.
+ *          No other operation ever compacts the list.
+ * 
+ * @param list Pointer to the initialized doubly linked list structure.
+ * @param threshold Fragmentation between 0 and 1 above which the list is compacted, or
+ *                  0 to turn the automatic compaction off.
+ * 
+ * @code
+ *   XDLL_SetAutoCompact(&myList, 0.5); // Compact when more than half of the links jump
+ * @endcode
+ * 
+ * @return This function does not return a value.
+ */
+void XDLL_SetAutoCompact(XDLList *list, double threshold) {
+
+    list->compactThreshold = threshold > 0 ? threshold : 0;
+    list->churn = 0;
+}
+
+/**
+ * @brief Compacts the list if churn has made it more fragmented than its threshold.
+ * 
+ * @details The fragmentation is only measured once the number of allocations and frees
+ *          since the last check reaches the length of the list, so the linear cost of
+ *          the measurement is spread over at least as many operations that changed the
+ *          list, and calling this function often, e.g. before every traversal, adds
+ *          constant amortized cost. Nothing happens unless a threshold was set with
+ *          XDLL_SetAutoCompact.
+ * 
+ * @param list Pointer to the initialized doubly linked list structure.
+ * 
+ * @post If the list was compacted, the active element and the cursors are moved along,
+ *       as by XDLL_Compact, and other element pointers kept outside of the list, such as
+ *       a DLLSegments index, are dangling. If the memory cannot be allocated, DLL_Error
+ *       is called and the list is unchanged.
+ * 
+ * @code
+ *   if (XDLL_MaybeCompact(&myList)) {
+ *       // Rebuild anything that points at elements of myList
+ *   }
+ * @endcode
+ * 
+ * @retval int TRUE if the list was compacted, FALSE otherwise.
+ */
+int XDLL_MaybeCompact(XDLList *list) {
+
+    if (list->compactThreshold <= 0 || list->churn < list->length) {
+        return FALSE;
+    }
+    list->churn = 0;
+    if (XDLL_Fragmentation(list) <= list->compactThreshold) {
+        return FALSE;
+    }
+    // XDLL_Compact leaves the list unchanged when it fails
+    DLLElementPtr first = list->base.firstElement;
+    XDLL_Compact(list);
+    return list->base.firstElement != first;
+}
+
+/**
+ * @brief Starts the prefetching lookahead of a scan beginning at 'element'.
+ * 
+ * @details A scan keeps a second pointer DLL_PREFETCH_DISTANCE elements in front of the
+ *          visited one and prefetches every element it reaches, so the visited elements
+ *          are in the cache when the scan gets to them. The lookahead itself still has to
+ *          follow the links one by one, so a scan of a scattered list remains bound by
+ *          the latency of these loads; the prefetching only keeps the work done on the
+ *          visited elements off that chain. Defining DLL_PREFETCH_DISTANCE at compile
+ *          time tunes the distance.
+ * 
+ * @param element First element of the scan, may be NULL.
+ * 
+ * @retval DLLElementPtr The element DLL_PREFETCH_DISTANCE elements after 'element', or
+ *                       NULL if the list ends before it.
+ */
+static DLLElementPtr XDLL_PrefetchStart(DLLElementPtr element) {
+
+    for (int i = 0; i < DLL_PREFETCH_DISTANCE && element != NULL; i++) {
+        element = element->nextElement;
+        DLL_PREFETCH(element);
+    }
+    return element;
+}
+
+/**
+ * @brief Moves the prefetching lookahead one element further.
+ * 
+ * @param ahead Current lookahead, may be NULL.
+ * 
+ * @retval DLLElementPtr The next lookahead, which has been prefetched.
+ */
+static inline DLLElementPtr XDLL_PrefetchNext(DLLElementPtr ahead) {
+
+    if (ahead == NULL) {
+        return NULL;
+    }
+    ahead = ahead->nextElement;
+    DLL_PREFETCH(ahead);
+    return ahead;
+}
+
+/**
+ * @brief Calls a function on every value of the list, from the first to the last.
+ * 
+ * @details The elements are visited by following their links directly while the
+ *          following ones are prefetched, which is considerably faster than a loop of
+ *          XDLL_Next and XDLL_GetValue calls on lists that do not fit in the cache.
+ * 
+ * @param list Pointer to the initialized doubly linked list structure.
+ * @param function Function receiving a pointer to each value and 'context'. It may
+ *                 change the value but must not insert or delete elements.
+ * @param context Pointer passed to every call of 'function', may be NULL.
+ * 
+ * @post The active element and the cursors are unchanged.
+ * 
+ * @code
+ *   void add(int *value, void *context) { *value += *(int *) context; }
+ *   int one = 1;
+ *   XDLL_ForEach(&myList, add, &one); // Increments every value
+ * @endcode
+ * 
+ * @return This function does not return a value.
+ */
+void XDLL_ForEach(XDLList *list, void (*function)(int *, void *), void *context) {
+
+    DLLElementPtr ahead = XDLL_PrefetchStart(list->base.firstElement);
+    for (DLLElementPtr element = list->base.firstElement; element != NULL; element = element->nextElement) {
+        ahead = XDLL_PrefetchNext(ahead);
+        function(&element->data, context);
+    }
+}
+
+/**
+ * @brief Combines all values of the list into one.
+ * 
+ * @details The list is scanned like in XDLL_ForEach, but the combination is done inline
+ *          instead of through a function call per element.
+ * 
+ * @param list Pointer to the initialized doubly linked list structure.
+ * @param reduction Combination to compute: DLL_REDUCE_SUM, DLL_REDUCE_MIN or
+ *                  DLL_REDUCE_MAX.
+ * 
+ * @retval long long The sum of the values, which is 0 for an empty list, or the smallest
+ *                   or largest value. The smallest and largest values of an empty list
+ *                   do not exist, so DLL_Error is called and 0 is returned.
+ */
+long long XDLL_Reduce(XDLList *list, DLLReduction reduction) {
+
+    if (list->base.firstElement == NULL) {
+        if (reduction != DLL_REDUCE_SUM) {
+            DLL_Error();
+        }
+        return 0;
+    }
+
+    long long result = reduction == DLL_REDUCE_SUM ? 0 : list->base.firstElement->data;
+    DLLElementPtr ahead = XDLL_PrefetchStart(list->base.firstElement);
+    for (DLLElementPtr element = list->base.firstElement; element != NULL; element = element->nextElement) {
+        ahead = XDLL_PrefetchNext(ahead);
+        switch (reduction) {
+            case DLL_REDUCE_SUM:
+                result += element->data;
+                break;
+            case DLL_REDUCE_MIN:
+                if (element->data < result) {
+                    result = element->data;
+                }
+                break;
+            case DLL_REDUCE_MAX:
+                if (element->data > result) {
+                    result = element->data;
+                }
+                break;
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Makes the first element holding a value active.
+ * 
+ * @details The list is scanned from the first element like in XDLL_ForEach. The position
+ *          of the found element is counted along, so XDLL_Position stays constant-time.
+ * 
+ * @param list Pointer to the initialized doubly linked list structure.
+ * @param data Value to look for.
+ * 
+ * @post If the value was found, its first occurrence is the active element. Otherwise
+ *       the active element is unchanged.
+ * 
+ * @retval int TRUE if the value was found, FALSE otherwise.
+ */
+int XDLL_Find(XDLList *list, int data) {
+
+    int position = 0;
+    DLLElementPtr ahead = XDLL_PrefetchStart(list->base.firstElement);
+    for (DLLElementPtr element = list->base.firstElement; element != NULL; element = element->nextElement) {
+        ahead = XDLL_PrefetchNext(ahead);
+        if (element->data == data) {
+            list->base.activeElement = element;
+            list->activePosition = position;
+            return TRUE;
+        }
+        position++;
+    }
+    return FALSE;
+}
+
+/**
+ * @brief Moves an element of the list to its beginning.
+ * 
+ * @details The element is relinked in place, without allocating or freeing anything, so
+ *          structures keeping pointers to elements, like the index of an LRU cache, stay
+ *          valid.
+ * 
+ * @param list Pointer to the initialized doubly linked list structure.
+ * @param element Element of 'list' to move, for example 'list->base.lastElement'.
+ * 
+ * @post The element is the first one and the other elements keep their order. The
+ *       active element and the cursors stay on their elements.
+ * 
+ * @return This function does not return a value.
+ */
+void XDLL_MoveToFirst(XDLList *list, DLLElementPtr element) {
+
+    if (element == list->base.firstElement) {
+        return;
+    }
+
+    XDLL_SeekRemoved(list, element, element);
+    element->previousElement->nextElement = element->nextElement;
+    if (element->nextElement != NULL) {
+        element->nextElement->previousElement = element->previousElement;
+    } else {
+        list->base.lastElement = element->previousElement;
+    }
+    element->previousElement = NULL;
+    element->nextElement = list->base.firstElement;
+    list->base.firstElement->previousElement = element;
+    list->base.firstElement = element;
+    XDLL_SeekInserted(list, element, 1);
+
+    if (list->base.activeElement == element) {
+        list->activePosition = 0;
+    } else {
+        // The active element may have moved one position further
+        list->activePosition = -1;
+    }
+}
+
+/**
+ * @brief Deletes an element of the list given by its pointer.
+ * 
+ * @param list Pointer to the initialized doubly linked list structure.
+ * @param element Element of 'list' to delete.
+ * 
+ * @post The element is removed. If it was active, the list becomes inactive; cursors on
+ *       it are deactivated.
+ * 
+ * @return This function does not return a value.
+ */
+void XDLL_DeleteElement(XDLList *list, DLLElementPtr element) {
+
+    if (list->base.activeElement != element) {
+        // The deleted element may lie in front of the active one
+        list->activePosition = -1;
+    }
+    XDLL_Unlink(list, element);
+}
+
+/* End of c206-ext.c */
@@ -0,0 +1,256 @@
+/**
+ * @file c206-ext.h
+ * @brief Extended operations on the doubly linked list of c206.h.
+ * @details Declares XDLList, which wraps the DLList of c206.h together with the state
+ *          that the extended operations need: the length of the list and the position
+ *          of its active element, kept up to date in constant time, an optional pool
+ *          the elements are taken from, the cursors registered with the list, and the
+ *          state of the automatic compaction and of the seek index.
+ *
+ *          The XDLL_* operations mirror the DLL_* operations of c206.h one to one and
+ *          add length and position queries, seeking, cursors, sorting, splicing, bulk
+ *          transfers, compaction and prefetching scans. The embedded list in 'base' may
+ *          be read and walked directly through its element pointers, but it must only be
+ *          changed through the XDLL_* operations, which keep the rest of the state in
+ *          step with it.
+ *
+ * @note c206.h has no include guard, so the other headers of this directory include it
+ *       through this one, and a translation unit including this header must not include
+ *       c206.h as well. This header also declares DLL_Error, which c206.c defines.
+ *
+ * @see c206.h for the list the operations work on.
+ *
+ * @see https://github.com/Jekwwer/IAL-Project01-2021 for the project repository.
+ */
+
+#ifndef _XDLL_H_
+#define _XDLL_H_
+
+#include "c206.h"
+
+/** Block of list elements allocated at once by a pool. */
+typedef struct DLLSlab {
+	/** Pointer to the next slab of the pool. */
+	struct DLLSlab *nextSlab;
+	/** Number of elements in the slab. */
+	size_t elementCount;
+	/** Contiguous storage of the elements. */
+	struct DLLElement elements[];
+} DLLSlab;
+
+/** Pool of list elements that may be shared by several lists. */
+typedef struct {
+	/** Pointer to the first slab of the pool, linked through 'nextSlab'. */
+	DLLSlab *slabs;
+	/** Unused elements linked through their nextElement pointers. */
+	DLLElementPtr freeElements;
+	/** Number of elements in 'freeElements'. */
+	size_t freeCount;
+	/** Number of elements allocated with every new slab. */
+	size_t elementsPerSlab;
+} DLLPool;
+
+/** Highest number of levels of a seek index, enough for lists of any int length. */
+#define DLL_SEEK_LEVELS 32
+
+/** Links of a node of a seek index on one of its levels. */
+typedef struct {
+	/** Next node on the level, or the head after the last node. */
+	struct DLLSeekNode *next;
+	/** Previous node on the level, or the head before the first node. */
+	struct DLLSeekNode *previous;
+	/** Number of elements from the node's element up to the next node's, or to the end. */
+	int span;
+} DLLSeekLink;
+
+/** Sampled element of a seek index, starting a run that lasts up to the next sample. */
+typedef struct DLLSeekNode {
+	/** The sampled element, or NULL for the head, whose run starts the list. */
+	DLLElementPtr element;
+	/** Number of levels the node is linked on, from 1 to DLL_SEEK_LEVELS. */
+	int levels;
+	/** Links of the node on each of its levels, from the lowest up. */
+	DLLSeekLink links[];
+} DLLSeekNode;
+
+/** Skip list over sampled elements of a list, counting the elements between them. */
+typedef struct {
+	/** Number of elements a run holds at least on average and at most twice. */
+	int stride;
+	/** Node linked on every level; its run holds the elements before the first sample. */
+	DLLSeekNode *head;
+	/** Number of levels currently used by the nodes. */
+	int levels;
+	/** Hash table with open addressing finding the node of a sampled element. */
+	DLLSeekNode **table;
+	/** Number of slots of 'table', a power of two. */
+	size_t capacity;
+	/** Number of nodes in 'table', the head excluded. */
+	size_t count;
+	/** State of the generator drawing the number of levels of new nodes. */
+	unsigned random;
+} DLLSeekIndex;
+
+/** Doubly linked list with the state of the extended operations. */
+typedef struct {
+	/** The list itself, changed only through the XDLL_* operations. */
+	DLList base;
+	/** Pool providing the elements, or NULL if they are allocated one by one. */
+	DLLPool *pool;
+	/** Number of elements in the list. */
+	int length;
+	/** Position of the active element counted from zero, or -1 if not known. */
+	int activePosition;
+	/** Cursors registered with the list. */
+	struct XDLLCursor *cursors;
+	/** Fragmentation above which XDLL_MaybeCompact compacts the list, or 0 to never do so. */
+	double compactThreshold;
+	/** Number of elements allocated or freed since the last fragmentation check. */
+	int churn;
+	/** Seek index kept up to date by every insertion and deletion, or NULL. */
+	DLLSeekIndex *seekIndex;
+} XDLList;
+
+/** Position in a list independent of the list's active element. */
+typedef struct XDLLCursor {
+	/** List the cursor belongs to. */
+	XDLList *list;
+	/** Element the cursor points to, or NULL if the cursor is inactive. */
+	DLLElementPtr element;
+	/** Pointer to the previous cursor registered with the same list. */
+	struct XDLLCursor *previousCursor;
+	/** Pointer to the next cursor registered with the same list. */
+	struct XDLLCursor *nextCursor;
+} XDLLCursor;
+
+/** Combination of the values computed by XDLL_Reduce. */
+typedef enum {
+	/** Sum of the values. */
+	DLL_REDUCE_SUM,
+	/** Smallest value. */
+	DLL_REDUCE_MIN,
+	/** Largest value. */
+	DLL_REDUCE_MAX
+} DLLReduction;
+
+void DLL_Error( void );
+
+void DLLPool_Init( DLLPool *, size_t );
+
+void DLLPool_Dispose( DLLPool * );
+
+void DLLPool_Trim( DLLPool * );
+
+void XDLL_Init( XDLList * );
+
+void XDLL_InitPooled( XDLList *, DLLPool * );
+
+void XDLL_Dispose( XDLList * );
+
+void XDLL_InsertFirst( XDLList *, int );
+
+void XDLL_InsertLast( XDLList *, int );
+
+void XDLL_First( XDLList * );
+
+void XDLL_Last( XDLList * );
+
+void XDLL_GetFirst( XDLList *, int * );
+
+void XDLL_GetLast( XDLList *, int * );
+
+void XDLL_DeleteFirst( XDLList * );
+
+void XDLL_DeleteLast( XDLList * );
+
+void XDLL_DeleteAfter( XDLList * );
+
+void XDLL_DeleteBefore( XDLList * );
+
+void XDLL_InsertAfter( XDLList *, int );
+
+void XDLL_InsertBefore( XDLList *, int );
+
+void XDLL_GetValue( XDLList *, int * );
+
+void XDLL_SetValue( XDLList *, int );
+
+void XDLL_Next( XDLList * );
+
+void XDLL_Previous( XDLList * );
+
+int XDLL_IsActive( XDLList * );
+
+int XDLL_Length( XDLList * );
+
+int XDLL_Position( XDLList * );
+
+void XDLL_Seek( XDLList *, int );
+
+void XDLL_SetSeekIndex( XDLList *, int );
+
+void XDLL_CursorInit( XDLLCursor *, XDLList * );
+
+void XDLL_CursorDispose( XDLLCursor * );
+
+void XDLL_CursorFirst( XDLLCursor * );
+
+void XDLL_CursorLast( XDLLCursor * );
+
+void XDLL_CursorNext( XDLLCursor * );
+
+void XDLL_CursorPrevious( XDLLCursor * );
+
+int XDLL_CursorIsActive( XDLLCursor * );
+
+void XDLL_CursorGetValue( XDLLCursor *, int * );
+
+void XDLL_CursorSetValue( XDLLCursor *, int );
+
+void XDLL_CursorInsertAfter( XDLLCursor *, int );
+
+void XDLL_CursorInsertBefore( XDLLCursor *, int );
+
+void XDLL_CursorDelete( XDLLCursor * );
+
+void XDLL_Sort( XDLList * );
+
+void XDLL_RadixSort( XDLList * );
+
+void XDLL_Concat( XDLList *, XDLList * );
+
+void XDLL_SpliceRange( XDLList *, XDLLCursor *, XDLLCursor * );
+
+void XDLL_Split( XDLList *, XDLList * );
+
+void XDLL_Reverse( XDLList * );
+
+void XDLL_InsertLastN( XDLList *, const int *, int );
+
+void XDLL_FromArray( XDLList *, const int *, int );
+
+int XDLL_ToArray( XDLList *, int *, int );
+
+int XDLL_RangeToArray( XDLList *, int, int, int * );
+
+double XDLL_Fragmentation( XDLList * );
+
+void XDLL_Compact( XDLList * );
+
+void XDLL_SetAutoCompact( XDLList *, double );
+
+int XDLL_MaybeCompact( XDLList * );
+
+void XDLL_ForEach( XDLList *, void (*)( int *, void * ), void * );
+
+long long XDLL_Reduce( XDLList *, DLLReduction );
+
+int XDLL_Find( XDLList *, int );
+
+void XDLL_MoveToFirst( XDLList *, DLLElementPtr );
+
+void XDLL_DeleteElement( XDLList *, DLLElementPtr );
+
+#endif
+
+/* End of c206-ext.h */
@@ -0,0 +1,233 @@
+/**
+ * @file c206-file.c
+ * @brief List file implementation file.
+ * @details Implements XDLL_Save and XDLL_Load declared in c206-file.h.
+ *
+ *          XDLL_Save writes the values in chunks into a uniquely named temporary file
+ *          next to the target, flushes it to the disk, renames it over the target and
+ *          then flushes the directory, so the target is always either the old file or
+ *          the complete new one, even if the program stops or the power fails while
+ *          saving, and two processes saving to the same path do not share a temporary
+ *          file.
+ *
+ *          XDLL_Load maps the file read-only, checks the header against the size of the
+ *          file and passes the mapped values straight to XDLL_FromArray, so no copy of
+ *          the payload is made and the kernel reads the file ahead sequentially.
+ *
+ *          The functions implemented are:
+ *          - XDLL_Save: Writes the list into a file.
+ *          - XDLL_Load: Replaces the contents of the list with those of a file.
+ *
+ * @code
+ * // Using example
+ * XDLL_Save(&list, "list.dll");
+ * // After a restart
+ * DLLPool pool;
+ * DLLPool_Init(&pool, 1024);
+ * XDLL_InitPooled(&list, &pool);
+ * if (!XDLL_Load(&list, "list.dll")) {
+ *     // Start with an empty list
+ * }
+ * @endcode
+ *
+ * @see c206-file.h for the file format.
+ *
+ * @see https://github.com/Jekwwer/IAL-Project01-2021 for the project repository.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "c206-file.h"
+
+#include <fcntl.h>
+#include <limits.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+_Static_assert(sizeof(int) == sizeof(int32_t), "the values are stored as int32_t");
+
+/** Number of values written by one fwrite call. */
+#define DLLFILE_CHUNK 4096
+
+/**
+ * @brief Writes the header and the values of the list into an open file.
+ *
+ * @param list Pointer to the initialized list.
+ * @param file File open for writing.
+ *
+ * @retval int TRUE if everything was written, FALSE otherwise.
+ */
+static int XDLL_WriteFile(XDLList *list, FILE *file) {
+
+    DLLFileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, DLLFILE_MAGIC, sizeof(DLLFILE_MAGIC));
+    header.byteOrder = DLLFILE_BYTE_ORDER;
+    header.version = DLLFILE_VERSION;
+    header.length = list->length;
+    header.activePosition = XDLL_Position(list);
+    if (fwrite(&header, sizeof(header), 1, file) != 1) {
+        return FALSE;
+    }
+
+    int32_t chunk[DLLFILE_CHUNK];
+    int count = 0;
+    for (DLLElementPtr element = list->base.firstElement; element != NULL; element = element->nextElement) {
+        chunk[count++] = element->data;
+        if (count == DLLFILE_CHUNK || element->nextElement == NULL) {
+            if (fwrite(chunk, sizeof(int32_t), count, file) != (size_t) count) {
+                return FALSE;
+            }
+            count = 0;
+        }
+    }
+    return fflush(file) == 0 && fsync(fileno(file)) == 0;
+}
+
+/**
+ * @brief Flushes the directory holding a file to the disk.
+ *
+ * @details A rename only survives a power loss once the directory entry itself has
+ *          reached the disk.
+ *
+ * @param path Path of a file in the directory.
+ *
+ * @retval int TRUE if the directory was flushed, FALSE otherwise.
+ */
+static int DLL_SyncDirectory(const char *path) {
+
+    const char *slash = strrchr(path, '/');
+    size_t length = slash == NULL ? 1 : slash == path ? 1 : (size_t) (slash - path);
+    char *directory = (char *) malloc(length + 1);
+    if (directory == NULL) {
+        return FALSE;
+    }
+    memcpy(directory, slash == NULL ? "." : path, length);
+    directory[length] = '\0';
+
+    int fd = open(directory, O_RDONLY | O_DIRECTORY);
+    free(directory);
+    if (fd < 0) {
+        return FALSE;
+    }
+    int synced = fsync(fd) == 0;
+    close(fd);
+    return synced;
+}
+
+/**
+ * @brief Writes the list into a binary file.
+ *
+ * @param list Pointer to the initialized doubly linked list structure.
+ * @param path Path of the file, which is created or replaced.
+ *
+ * @post The file holds the values of the list in list order and the position of the
+ *       active element. The list is unchanged. A replaced file keeps its permissions, a
+ *       new one is readable by everybody and writable by the owner. If saving fails, the
+ *       file is left as it was before.
+ *
+ * @retval int TRUE on success, FALSE if the file could not be written or the replacement
+ *             could not be flushed to the disk.
+ */
+int XDLL_Save(XDLList *list, const char *path) {
+
+    // Write next to the target so that the rename stays within one file system
+    size_t pathLength = strlen(path);
+    char *temporaryPath = (char *) malloc(pathLength + sizeof(".XXXXXX"));
+    if (temporaryPath == NULL) {
+        return FALSE;
+    }
+    memcpy(temporaryPath, path, pathLength);
+    memcpy(temporaryPath + pathLength, ".XXXXXX", sizeof(".XXXXXX"));
+
+    int fd = mkstemp(temporaryPath);
+    if (fd < 0) {
+        free(temporaryPath);
+        return FALSE;
+    }
+    struct stat status;
+    fchmod(fd, stat(path, &status) == 0 ? status.st_mode & 07777 : 0644);
+
+    FILE *file = fdopen(fd, "wb");
+    if (file == NULL) {
+        close(fd);
+    }
+    int saved = file != NULL && XDLL_WriteFile(list, file);
+    if (file != NULL && fclose(file) != 0) {
+        saved = FALSE;
+    }
+    if (saved) {
+        saved = rename(temporaryPath, path) == 0;
+    }
+    if (saved) {
+        saved = DLL_SyncDirectory(path);
+    } else {
+        remove(temporaryPath);
+    }
+
+    free(temporaryPath);
+    return saved;
+}
+
+/**
+ * @brief Replaces the contents of the list with those of a binary file.
+ *
+ * @details The whole file is checked before the list is touched: the identification,
+ *          byte order and version in the header, and the size of the file against the
+ *          number of values.
+ *
+ * @param list Pointer to the initialized doubly linked list structure.
+ * @param path Path of a file written by XDLL_Save.
+ *
+ * @post On success the list holds the values of the file, and the element at the saved
+ *       active position is active. Otherwise the list is unchanged, except when the
+ *       memory for the elements cannot be allocated: then DLL_Error is called and the
+ *       list is empty.
+ *
+ * @retval int TRUE on success, FALSE if the file cannot be read, is not a list file or
+ *             is damaged, or if the memory cannot be allocated.
+ */
+int XDLL_Load(XDLList *list, const char *path) {
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return FALSE;
+    }
+    struct stat status;
+    if (fstat(fd, &status) != 0 || status.st_size < (off_t) sizeof(DLLFileHeader)) {
+        close(fd);
+        return FALSE;
+    }
+    size_t size = (size_t) status.st_size;
+    void *map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        return FALSE;
+    }
+    posix_madvise(map, size, POSIX_MADV_SEQUENTIAL);
+
+    const DLLFileHeader *header = (const DLLFileHeader *) map;
+    int valid = memcmp(header->magic, DLLFILE_MAGIC, sizeof(DLLFILE_MAGIC)) == 0 &&
+                header->byteOrder == DLLFILE_BYTE_ORDER &&
+                header->version == DLLFILE_VERSION &&
+                header->length >= 0 && header->length <= INT_MAX &&
+                size == sizeof(DLLFileHeader) + (size_t) header->length * sizeof(int32_t) &&
+                header->activePosition >= -1 && header->activePosition < header->length;
+
+    if (valid) {
+        int length = (int) header->length;
+        int activePosition = (int) header->activePosition;
+        XDLL_FromArray(list, (const int *) (header + 1), length);
+        valid = list->length == length;
+        if (valid && activePosition >= 0) {
+            XDLL_Seek(list, activePosition);
+        }
+    }
+
+    munmap(map, size);
+    return valid;
+}
+
+/* End of c206-file.c */
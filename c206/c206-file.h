@@ -0,0 +1,57 @@
+/**
+ * @file c206-file.h
+ * @brief Binary files holding the contents of a c206 list.
+ * @details Declares XDLL_Save and XDLL_Load, which store a list in a compact binary
+ *          file and read it back, so that a restarted program does not have to rebuild
+ *          its lists value by value from a text dump.
+ *
+ *          A file consists of a fixed header followed by the values as packed 32-bit
+ *          integers in list order. The header records the number of values and the
+ *          position of the active element, so a loaded list continues where the saved
+ *          one was. XDLL_Load maps the file into memory and creates all elements with
+ *          a single XDLL_FromArray call, which takes one slab for a pooled list.
+ *
+ * @note The values are stored in the byte order of the machine that saved them; the
+ *       header contains a byte-order mark, and files from a machine of the other byte
+ *       order are rejected instead of being misread.
+ *
+ * @see c206-ext.h for the list.
+ *
+ * @see https://github.com/Jekwwer/IAL-Project01-2021 for the project repository.
+ */
+
+#ifndef _DLLFILE_H_
+#define _DLLFILE_H_
+
+#include <stdint.h>
+
+#include "c206-ext.h"
+
+/** Identification at the beginning of every list file. */
+#define DLLFILE_MAGIC "C206DLL"
+/** Version of the file format. */
+#define DLLFILE_VERSION 1
+/** Byte-order mark, reads differently on a machine of the other byte order. */
+#define DLLFILE_BYTE_ORDER 0x01020304u
+
+/** Header of a list file, followed by 'length' values of type int32_t. */
+typedef struct {
+	/** DLLFILE_MAGIC including the terminating zero. */
+	char magic[8];
+	/** DLLFILE_BYTE_ORDER as written by the saving machine. */
+	uint32_t byteOrder;
+	/** DLLFILE_VERSION of the saving program. */
+	uint32_t version;
+	/** Number of values. */
+	int64_t length;
+	/** Position of the active element counted from zero, or -1 if the list was inactive. */
+	int64_t activePosition;
+} DLLFileHeader;
+
+int XDLL_Save( XDLList *, const char * );
+
+int XDLL_Load( XDLList *, const char * );
+
+#endif
+
+/* End of c206-file.h */
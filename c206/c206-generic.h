@@ -0,0 +1,229 @@
+/**
+ * @file c206-generic.h
+ * @brief Doubly linked lists of any payload type, generated by a macro.
+ * @details DLLElement carries a single int, so a list of records has to store pointers
+ *          to records allocated separately, which costs a second allocation and a second
+ *          cache miss per element. DLL_DEFINE(Name, Type) generates a list type 'Name'
+ *          whose elements embed a 'Type' directly after their links, so one allocation,
+ *          and for small types one cache line, holds both.
+ *
+ *          The generated operations are static inline functions mirroring the DLL_*
+ *          operations of c206.h one to one, named Name_Init, Name_InsertFirst and so on,
+ *          with values of 'Type' in place of int. Name_ValuePtr additionally returns a
+ *          pointer to the payload of the active element, so large records can be read
+ *          and changed in place instead of being copied by Name_GetValue and
+ *          Name_SetValue. Name_Length returns the number of elements in constant time.
+ *
+ *          Like DLL_* operations, the generated ones call DLL_Error when a value is
+ *          requested from an empty or inactive list, or when memory runs out.
+ *
+ * @code
+ * typedef struct { double x, y; char label[16]; } Point;
+ * DLL_DEFINE(PointList, Point)
+ *
+ * PointList points;
+ * PointList_Init(&points);
+ * PointList_InsertLast(&points, (Point) { 1.0, 2.0, "origin" });
+ * PointList_First(&points);
+ * PointList_ValuePtr(&points)->x += 1.0;
+ * PointList_Dispose(&points);
+ * @endcode
+ *
+ * @note Every instantiation must use a different 'Name'. The macro defines the functions
+ *       in each translation unit that expands it; a type shared by several units is
+ *       best defined in a header of its own.
+ *
+ * @see c206.h for the int list the generated lists mirror.
+ *
+ * @see https://github.com/Jekwwer/IAL-Project01-2021 for the project repository.
+ */
+
+#ifndef _GDLL_H_
+#define _GDLL_H_
+
+#include "c206-ext.h"
+
+/** Generates the list type 'Name' holding values of 'Type' and its operations. */
+#define DLL_DEFINE(Name, Type) \
+\
+typedef struct Name##Element { \
+	struct Name##Element *previousElement; \
+	struct Name##Element *nextElement; \
+	Type data; \
+} Name##Element; \
+\
+typedef struct { \
+	Name##Element *firstElement; \
+	Name##Element *activeElement; \
+	Name##Element *lastElement; \
+	int length; \
+} Name; \
+\
+static inline void Name##_Init(Name *list) { \
+    list->firstElement = list->activeElement = list->lastElement = NULL; \
+    list->length = 0; \
+} \
+\
+static inline void Name##_Dispose(Name *list) { \
+    Name##Element *element = list->firstElement; \
+    while (element != NULL) { \
+        Name##Element *next = element->nextElement; \
+        free(element); \
+        element = next; \
+    } \
+    Name##_Init(list); \
+} \
+\
+static inline void Name##_Link(Name *list, Name##Element *previous, Name##Element *next, Type data) { \
+    Name##Element *element = (Name##Element *) malloc(sizeof(Name##Element)); \
+    if (element == NULL) { \
+        DLL_Error(); \
+        return; \
+    } \
+    element->data = data; \
+    element->previousElement = previous; \
+    element->nextElement = next; \
+    if (previous != NULL) { \
+        previous->nextElement = element; \
+    } else { \
+        list->firstElement = element; \
+    } \
+    if (next != NULL) { \
+        next->previousElement = element; \
+    } else { \
+        list->lastElement = element; \
+    } \
+    list->length++; \
+} \
+\
+static inline void Name##_Unlink(Name *list, Name##Element *element) { \
+    if (element->previousElement != NULL) { \
+        element->previousElement->nextElement = element->nextElement; \
+    } else { \
+        list->firstElement = element->nextElement; \
+    } \
+    if (element->nextElement != NULL) { \
+        element->nextElement->previousElement = element->previousElement; \
+    } else { \
+        list->lastElement = element->previousElement; \
+    } \
+    if (list->activeElement == element) { \
+        list->activeElement = NULL; \
+    } \
+    list->length--; \
+    free(element); \
+} \
+\
+static inline void Name##_InsertFirst(Name *list, Type data) { \
+    Name##_Link(list, NULL, list->firstElement, data); \
+} \
+\
+static inline void Name##_InsertLast(Name *list, Type data) { \
+    Name##_Link(list, list->lastElement, NULL, data); \
+} \
+\
+static inline void Name##_First(Name *list) { \
+    list->activeElement = list->firstElement; \
+} \
+\
+static inline void Name##_Last(Name *list) { \
+    list->activeElement = list->lastElement; \
+} \
+\
+static inline void Name##_GetFirst(Name *list, Type *dataPtr) { \
+    if (list->firstElement == NULL) { \
+        DLL_Error(); \
+    } else { \
+        *dataPtr = list->firstElement->data; \
+    } \
+} \
+\
+static inline void Name##_GetLast(Name *list, Type *dataPtr) { \
+    if (list->lastElement == NULL) { \
+        DLL_Error(); \
+    } else { \
+        *dataPtr = list->lastElement->data; \
+    } \
+} \
+\
+static inline void Name##_DeleteFirst(Name *list) { \
+    if (list->firstElement != NULL) { \
+        Name##_Unlink(list, list->firstElement); \
+    } \
+} \
+\
+static inline void Name##_DeleteLast(Name *list) { \
+    if (list->lastElement != NULL) { \
+        Name##_Unlink(list, list->lastElement); \
+    } \
+} \
+\
+static inline void Name##_DeleteAfter(Name *list) { \
+    if (list->activeElement != NULL && list->activeElement->nextElement != NULL) { \
+        Name##_Unlink(list, list->activeElement->nextElement); \
+    } \
+} \
+\
+static inline void Name##_DeleteBefore(Name *list) { \
+    if (list->activeElement != NULL && list->activeElement->previousElement != NULL) { \
+        Name##_Unlink(list, list->activeElement->previousElement); \
+    } \
+} \
+\
+static inline void Name##_InsertAfter(Name *list, Type data) { \
+    if (list->activeElement != NULL) { \
+        Name##_Link(list, list->activeElement, list->activeElement->nextElement, data); \
+    } \
+} \
+\
+static inline void Name##_InsertBefore(Name *list, Type data) { \
+    if (list->activeElement != NULL) { \
+        Name##_Link(list, list->activeElement->previousElement, list->activeElement, data); \
+    } \
+} \
+\
+static inline void Name##_GetValue(Name *list, Type *dataPtr) { \
+    if (list->activeElement == NULL) { \
+        DLL_Error(); \
+    } else { \
+        *dataPtr = list->activeElement->data; \
+    } \
+} \
+\
+static inline void Name##_SetValue(Name *list, Type data) { \
+    if (list->activeElement != NULL) { \
+        list->activeElement->data = data; \
+    } \
+} \
+\
+static inline Type *Name##_ValuePtr(Name *list) { \
+    if (list->activeElement == NULL) { \
+        DLL_Error(); \
+        return NULL; \
+    } \
+    return &list->activeElement->data; \
+} \
+\
+static inline void Name##_Next(Name *list) { \
+    if (list->activeElement != NULL) { \
+        list->activeElement = list->activeElement->nextElement; \
+    } \
+} \
+\
+static inline void Name##_Previous(Name *list) { \
+    if (list->activeElement != NULL) { \
+        list->activeElement = list->activeElement->previousElement; \
+    } \
+} \
+\
+static inline int Name##_IsActive(Name *list) { \
+    return list->activeElement != NULL; \
+} \
+\
+static inline int Name##_Length(Name *list) { \
+    return list->length; \
+}
+
+#endif
+
+/* End of c206-generic.h */
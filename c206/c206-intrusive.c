@@ -0,0 +1,403 @@
+/**
+ * @file c206-intrusive.c
+ * @brief Implementation of the intrusive doubly linked list.
+ * @details Implements the IDLL_* operations declared in c206-intrusive.h. Every insertion
+ *          goes through IDLL_Link, which places a link between two neighbours, and every
+ *          deletion through IDLL_Unlink; the public operations only pick the neighbours.
+ *          No operation allocates or frees memory.
+ *
+ * @code
+ * // Example usage:
+ * typedef struct { int id; IDLLink link; } Item;
+ * Item items[100];
+ * IDLList list;
+ * IDLL_Init(&list);
+ * for (int i = 0; i < 100; i++) {
+ *     items[i].id = i;
+ *     IDLL_InsertLast(&list, &items[i].link);  // No allocation
+ * }
+ * IDLL_Remove(&list, &items[42].link);          // O(1), no search
+ * IDLL_Dispose(&list);
+ * @endcode
+ *
+ * @see c206-intrusive.h for definition of constants and types.
+ *
+ * @see https://github.com/Jekwwer/IAL-Project01-2021 for the project repository.
+ */
+
+#include "c206-intrusive.h"
+
+/**
+ * @brief Links an object between two neighbouring elements.
+ *
+ * @param list Pointer to the initialized intrusive list.
+ * @param link Link of the object, not in any list.
+ * @param previous Element the new one follows, or NULL to insert it first.
+ * @param next Element the new one precedes, or NULL to insert it last.
+ */
+static void IDLL_Link(IDLList *list, IDLLink *link, IDLLink *previous, IDLLink *next) {
+
+    link->previousLink = previous;
+    link->nextLink = next;
+
+    if (previous != NULL) {
+        previous->nextLink = link;
+    } else {
+        list->firstLink = link;
+    }
+    if (next != NULL) {
+        next->previousLink = link;
+    } else {
+        list->lastLink = link;
+    }
+    list->length++;
+}
+
+/**
+ * @brief Unlinks an element.
+ *
+ * @param list Pointer to the initialized intrusive list.
+ * @param link Link of an element of the list.
+ *
+ * @post The element is removed and its link cleared; if it was active, the list becomes
+ *       inactive.
+ */
+static void IDLL_Unlink(IDLList *list, IDLLink *link) {
+
+    if (link->previousLink != NULL) {
+        link->previousLink->nextLink = link->nextLink;
+    } else {
+        list->firstLink = link->nextLink;
+    }
+    if (link->nextLink != NULL) {
+        link->nextLink->previousLink = link->previousLink;
+    } else {
+        list->lastLink = link->previousLink;
+    }
+    if (list->activeLink == link) {
+        list->activeLink = NULL;
+    }
+
+    link->previousLink = NULL;
+    link->nextLink = NULL;
+    list->length--;
+}
+
+/**
+ * @brief Initializes the intrusive list.
+ *
+ * @param list Pointer to the intrusive list structure to be initialized.
+ *
+ * @post The list is empty and inactive.
+ *
+ * @return This function does not return a value.
+ */
+void IDLL_Init(IDLList *list) {
+
+    list->firstLink = NULL;
+    list->activeLink = NULL;
+    list->lastLink = NULL;
+    list->length = 0;
+}
+
+/**
+ * @brief Detaches all elements from the list and reinitializes it.
+ *
+ * @details The list owns no memory, so nothing is freed. The links of the objects are
+ *          cleared one by one, as IDLL_Unlink does, so no object keeps pointers into the
+ *          list after it is gone.
+ *
+ * @param list Pointer to the initialized intrusive list.
+ *
+ * @post The list is in the same state as after IDLL_Init and the links of all former
+ *       elements are cleared, so the objects may be inserted into any list again.
+ *
+ * @return This function does not return a value.
+ */
+void IDLL_Dispose(IDLList *list) {
+
+    IDLLink *link = list->firstLink;
+    while (link != NULL) {
+        IDLLink *next = link->nextLink;
+        link->previousLink = NULL;
+        link->nextLink = NULL;
+        link = next;
+    }
+    IDLL_Init(list);
+}
+
+/**
+ * @brief Inserts an object at the beginning of the list.
+ *
+ * @param list Pointer to the initialized intrusive list.
+ * @param link Link of the object, not in any list.
+ *
+ * @return This function does not return a value.
+ */
+void IDLL_InsertFirst(IDLList *list, IDLLink *link) {
+
+    IDLL_Link(list, link, NULL, list->firstLink);
+}
+
+/**
+ * @brief Inserts an object at the end of the list.
+ *
+ * @param list Pointer to the initialized intrusive list.
+ * @param link Link of the object, not in any list.
+ *
+ * @return This function does not return a value.
+ */
+void IDLL_InsertLast(IDLList *list, IDLLink *link) {
+
+    IDLL_Link(list, link, list->lastLink, NULL);
+}
+
+/**
+ * @brief Sets the first element of the list as active.
+ *
+ * @param list Pointer to the initialized intrusive list.
+ *
+ * @return This function does not return a value.
+ */
+void IDLL_First(IDLList *list) {
+
+    list->activeLink = list->firstLink;
+}
+
+/**
+ * @brief Sets the last element of the list as active.
+ *
+ * @param list Pointer to the initialized intrusive list.
+ *
+ * @return This function does not return a value.
+ */
+void IDLL_Last(IDLList *list) {
+
+    list->activeLink = list->lastLink;
+}
+
+/**
+ * @brief Returns the first element of the list.
+ *
+ * @param list Pointer to the initialized intrusive list.
+ *
+ * @post If the list is empty, DLL_Error is called.
+ *
+ * @retval IDLLink* Link of the first element, or NULL if the list is empty.
+ */
+IDLLink *IDLL_GetFirst(IDLList *list) {
+
+    if (list->firstLink == NULL) {
+        DLL_Error();
+    }
+    return list->firstLink;
+}
+
+/**
+ * @brief Returns the last element of the list.
+ *
+ * @param list Pointer to the initialized intrusive list.
+ *
+ * @post If the list is empty, DLL_Error is called.
+ *
+ * @retval IDLLink* Link of the last element, or NULL if the list is empty.
+ */
+IDLLink *IDLL_GetLast(IDLList *list) {
+
+    if (list->lastLink == NULL) {
+        DLL_Error();
+    }
+    return list->lastLink;
+}
+
+/**
+ * @brief Unlinks the first element of the list.
+ *
+ * @param list Pointer to the initialized intrusive list.
+ *
+ * @post The object stays where it is and may be inserted again or released by its
+ *       owner. If it was active, the list becomes inactive. An empty list is unchanged.
+ *
+ * @return This function does not return a value.
+ */
+void IDLL_DeleteFirst(IDLList *list) {
+
+    if (list->firstLink != NULL) {
+        IDLL_Unlink(list, list->firstLink);
+    }
+}
+
+/**
+ * @brief Unlinks the last element of the list.
+ *
+ * @param list Pointer to the initialized intrusive list.
+ *
+ * @post As for IDLL_DeleteFirst.
+ *
+ * @return This function does not return a value.
+ */
+void IDLL_DeleteLast(IDLList *list) {
+
+    if (list->lastLink != NULL) {
+        IDLL_Unlink(list, list->lastLink);
+    }
+}
+
+/**
+ * @brief Unlinks the element following the active one.
+ *
+ * @param list Pointer to the initialized intrusive list.
+ *
+ * @post Nothing happens if the list is inactive or the active element is the last one.
+ *
+ * @return This function does not return a value.
+ */
+void IDLL_DeleteAfter(IDLList *list) {
+
+    if (list->activeLink != NULL && list->activeLink->nextLink != NULL) {
+        IDLL_Unlink(list, list->activeLink->nextLink);
+    }
+}
+
+/**
+ * @brief Unlinks the element preceding the active one.
+ *
+ * @param list Pointer to the initialized intrusive list.
+ *
+ * @post Nothing happens if the list is inactive or the active element is the first one.
+ *
+ * @return This function does not return a value.
+ */
+void IDLL_DeleteBefore(IDLList *list) {
+
+    if (list->activeLink != NULL && list->activeLink->previousLink != NULL) {
+        IDLL_Unlink(list, list->activeLink->previousLink);
+    }
+}
+
+/**
+ * @brief Inserts an object after the active element.
+ *
+ * @param list Pointer to the initialized intrusive list.
+ * @param link Link of the object, not in any list.
+ *
+ * @post Nothing happens if the list is inactive.
+ *
+ * @return This function does not return a value.
+ */
+void IDLL_InsertAfter(IDLList *list, IDLLink *link) {
+
+    if (list->activeLink != NULL) {
+        IDLL_Link(list, link, list->activeLink, list->activeLink->nextLink);
+    }
+}
+
+/**
+ * @brief Inserts an object before the active element.
+ *
+ * @param list Pointer to the initialized intrusive list.
+ * @param link Link of the object, not in any list.
+ *
+ * @post Nothing happens if the list is inactive.
+ *
+ * @return This function does not return a value.
+ */
+void IDLL_InsertBefore(IDLList *list, IDLLink *link) {
+
+    if (list->activeLink != NULL) {
+        IDLL_Link(list, link, list->activeLink->previousLink, list->activeLink);
+    }
+}
+
+/**
+ * @brief Returns the active element.
+ *
+ * @param list Pointer to the initialized intrusive list.
+ *
+ * @post If the list is inactive, DLL_Error is called.
+ *
+ * @retval IDLLink* Link of the active element, or NULL if the list is inactive.
+ */
+IDLLink *IDLL_GetValue(IDLList *list) {
+
+    if (list->activeLink == NULL) {
+        DLL_Error();
+    }
+    return list->activeLink;
+}
+
+/**
+ * @brief Unlinks any element of the list.
+ *
+ * @details The link knows its neighbours, so an object can leave the list in constant
+ *          time without searching for it, e.g. when it is released by its owner.
+ *
+ * @param list Pointer to the initialized intrusive list.
+ * @param link Link of an element of this list.
+ *
+ * @post As for IDLL_DeleteFirst.
+ *
+ * @return This function does not return a value.
+ */
+void IDLL_Remove(IDLList *list, IDLLink *link) {
+
+    IDLL_Unlink(list, link);
+}
+
+/**
+ * @brief Moves the activity to the next element.
+ *
+ * @param list Pointer to the initialized intrusive list.
+ *
+ * @post The list becomes inactive if the last element was active.
+ *
+ * @return This function does not return a value.
+ */
+void IDLL_Next(IDLList *list) {
+
+    if (list->activeLink != NULL) {
+        list->activeLink = list->activeLink->nextLink;
+    }
+}
+
+/**
+ * @brief Moves the activity to the previous element.
+ *
+ * @param list Pointer to the initialized intrusive list.
+ *
+ * @post The list becomes inactive if the first element was active.
+ *
+ * @return This function does not return a value.
+ */
+void IDLL_Previous(IDLList *list) {
+
+    if (list->activeLink != NULL) {
+        list->activeLink = list->activeLink->previousLink;
+    }
+}
+
+/**
+ * @brief Checks whether the list is active.
+ *
+ * @param list Pointer to the initialized intrusive list.
+ *
+ * @retval int Nonzero if an element is active, zero otherwise.
+ */
+int IDLL_IsActive(IDLList *list) {
+
+    return list->activeLink != NULL;
+}
+
+/**
+ * @brief Returns the number of elements in the list.
+ *
+ * @param list Pointer to the initialized intrusive list.
+ *
+ * @retval int Number of elements, kept up to date by every operation.
+ */
+int IDLL_Length(IDLList *list) {
+
+    return list->length;
+}
+
+/* End of c206-intrusive.c */
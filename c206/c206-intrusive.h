@@ -0,0 +1,110 @@
+/**
+ * @file c206-intrusive.h
+ * @brief Intrusive doubly linked list whose links are embedded in the user's objects.
+ * @details Declares a list variant that allocates nothing. Instead of a DLLElement holding
+ *          a value, the user's structure contains an IDLLink, and the list chains those
+ *          links together. An object that already lives in a pool or an array therefore
+ *          joins a list without any allocation, and an object with several IDLLink
+ *          members can be in as many lists at once.
+ *
+ *          IDLL_ENTRY turns a link back into a pointer to the object containing it. The
+ *          operations mirror the DLL_* operations of c206.h, except that they take and
+ *          return links instead of int values: the Insert* operations link a given
+ *          object, the Get* operations return the link of an element, and the Delete*
+ *          operations unlink an element without releasing anything. IDLL_Remove unlinks
+ *          any element in constant time, given only its link.
+ *
+ * @code
+ * typedef struct {
+ *     int id;
+ *     IDLLink queueLink;          // Membership in a queue
+ *     IDLLink ownerLink;          // Membership in the list of its owner
+ * } Task;
+ *
+ * IDLList queue;
+ * IDLL_Init(&queue);
+ * IDLL_InsertLast(&queue, &task->queueLink);
+ * Task *next = IDLL_ENTRY(IDLL_GetFirst(&queue), Task, queueLink);
+ * @endcode
+ *
+ * @note The list does not own the objects. An object must be unlinked from every list
+ *       before it is released or reused, and a link can be in one list at a time.
+ *
+ * @see c206.h for the list the variant mirrors.
+ *
+ * @see https://github.com/Jekwwer/IAL-Project01-2021 for the project repository.
+ */
+
+#ifndef _IDLL_H_
+#define _IDLL_H_
+
+#include <stddef.h>
+
+#include "c206-ext.h"
+
+/** Returns a pointer to the object of type 'type' whose member 'member' is the link 'link'. */
+#define IDLL_ENTRY(link, type, member) ((type *) ((char *) (link) - offsetof(type, member)))
+
+/** Link embedded in an object, one per list the object can be in. */
+typedef struct IDLLink {
+	/** Link of the previous element in the list. */
+	struct IDLLink *previousLink;
+	/** Link of the next element in the list. */
+	struct IDLLink *nextLink;
+} IDLLink;
+
+/** Intrusive doubly linked list. */
+typedef struct {
+	/** Link of the first element in the list. */
+	IDLLink *firstLink;
+	/** Link of the current element in the list. */
+	IDLLink *activeLink;
+	/** Link of the last element in the list. */
+	IDLLink *lastLink;
+	/** Number of elements in the list. */
+	int length;
+} IDLList;
+
+void IDLL_Init( IDLList * );
+
+void IDLL_Dispose( IDLList * );
+
+void IDLL_InsertFirst( IDLList *, IDLLink * );
+
+void IDLL_InsertLast( IDLList *, IDLLink * );
+
+void IDLL_First( IDLList * );
+
+void IDLL_Last( IDLList * );
+
+IDLLink *IDLL_GetFirst( IDLList * );
+
+IDLLink *IDLL_GetLast( IDLList * );
+
+void IDLL_DeleteFirst( IDLList * );
+
+void IDLL_DeleteLast( IDLList * );
+
+void IDLL_DeleteAfter( IDLList * );
+
+void IDLL_DeleteBefore( IDLList * );
+
+void IDLL_InsertAfter( IDLList *, IDLLink * );
+
+void IDLL_InsertBefore( IDLList *, IDLLink * );
+
+IDLLink *IDLL_GetValue( IDLList * );
+
+void IDLL_Remove( IDLList *, IDLLink * );
+
+void IDLL_Next( IDLList * );
+
+void IDLL_Previous( IDLList * );
+
+int IDLL_IsActive( IDLList * );
+
+int IDLL_Length( IDLList * );
+
+#endif
+
+/* End of c206-intrusive.h */
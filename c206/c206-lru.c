@@ -0,0 +1,304 @@
+/**
+ * @file c206-lru.c
+ * @brief LRU cache implementation file.
+ * @details Implements the cache declared in c206-lru.h. A cache limited by the number of
+ *          entries allocates its hash table once, with at least twice as many slots as
+ *          entries; a cache limited by bytes only doubles its table whenever it becomes
+ *          half full. Either way the probe sequences stay short.
+ *
+ *          The functions implemented are:
+ *          - LRU_Init:    Sets up an empty cache with its limits.
+ *          - LRU_Dispose: Releases all entries and the table.
+ *          - LRU_Get:     Looks a key up and marks it as most recently used.
+ *          - LRU_Put:     Inserts or updates an entry, evicting as needed.
+ *          - LRU_Remove:  Deletes an entry.
+ *          - LRU_Count:   Returns the number of entries.
+ *
+ * @code
+ * // Using example
+ * LRUCache cache;
+ * LRU_Init(&cache, 100000, 0);        // At most 100000 entries
+ * int value;
+ * if (!LRU_Get(&cache, key, &value)) {
+ *     value = compute(key);
+ *     LRU_Put(&cache, key, value, 0);
+ * }
+ * LRU_Dispose(&cache);
+ * @endcode
+ *
+ * @see c206-lru.h for type definitions.
+ *
+ * @see https://github.com/Jekwwer/IAL-Project01-2021 for the project repository.
+ */
+
+#include "c206-lru.h"
+
+#include <stdint.h>
+
+/** Number of slots of a table that grows. */
+#define LRU_INITIAL_SLOTS 16
+
+/**
+ * @brief Returns the home slot of a key.
+ *
+ * @details The bits of the key are mixed (the finalizer of MurmurHash3), so that keys
+ *          following one another do not fill one run of neighbouring slots.
+ *
+ * @param key Key to hash.
+ * @param mask Size of the table minus one.
+ *
+ * @retval size_t Index of the slot where the probe sequence of the key starts.
+ */
+static size_t LRU_Hash(int key, size_t mask) {
+
+    uint32_t hash = (uint32_t) key;
+    hash ^= hash >> 16;
+    hash *= 0x85ebca6bu;
+    hash ^= hash >> 13;
+    hash *= 0xc2b2ae35u;
+    hash ^= hash >> 16;
+    return hash & mask;
+}
+
+/**
+ * @brief Finds the slot of a key.
+ *
+ * @param cache Pointer to the initialized cache.
+ * @param key Key to look for.
+ *
+ * @retval size_t Index of the slot holding the key, or of the empty slot ending its
+ *                probe sequence if the key is not in the table.
+ */
+static size_t LRU_FindSlot(LRUCache *cache, int key) {
+
+    size_t slot = LRU_Hash(key, cache->slotMask);
+    while (cache->slots[slot].element != NULL && cache->slots[slot].key != key) {
+        slot = (slot + 1) & cache->slotMask;
+    }
+    return slot;
+}
+
+/**
+ * @brief Empties a slot, moving later entries of the probe sequence into the gap.
+ *
+ * @param cache Pointer to the initialized cache.
+ * @param slot Index of a full slot.
+ */
+static void LRU_ClearSlot(LRUCache *cache, size_t slot) {
+
+    size_t hole = slot;
+    for (size_t next = (hole + 1) & cache->slotMask; cache->slots[next].element != NULL;
+         next = (next + 1) & cache->slotMask) {
+        // An entry may fill the hole unless its home lies cyclically after the hole
+        size_t home = LRU_Hash(cache->slots[next].key, cache->slotMask);
+        if (((next - home) & cache->slotMask) >= ((next - hole) & cache->slotMask)) {
+            cache->slots[hole] = cache->slots[next];
+            hole = next;
+        }
+    }
+    cache->slots[hole].element = NULL;
+}
+
+/**
+ * @brief Allocates an empty table and moves the entries into it.
+ *
+ * @param cache Pointer to the cache.
+ * @param slotCount Number of slots, a power of two larger than the number of entries.
+ *
+ * @retval int TRUE on success, FALSE if the table could not be allocated, in which case
+ *             the cache is unchanged.
+ */
+static int LRU_Resize(LRUCache *cache, size_t slotCount) {
+
+    LRUEntry *slots = (LRUEntry *) calloc(slotCount, sizeof(LRUEntry));
+    if (slots == NULL) {
+        return FALSE;
+    }
+    LRUEntry *oldSlots = cache->slots;
+    size_t oldCount = oldSlots != NULL ? cache->slotMask + 1 : 0;
+    cache->slots = slots;
+    cache->slotMask = slotCount - 1;
+    for (size_t i = 0; i < oldCount; i++) {
+        if (oldSlots[i].element != NULL) {
+            cache->slots[LRU_FindSlot(cache, oldSlots[i].key)] = oldSlots[i];
+        }
+    }
+    free(oldSlots);
+    return TRUE;
+}
+
+/**
+ * @brief Deletes the entry in a slot.
+ *
+ * @param cache Pointer to the initialized cache.
+ * @param slot Index of a full slot.
+ */
+static void LRU_DeleteSlot(LRUCache *cache, size_t slot) {
+
+    XDLL_DeleteElement(&cache->order, cache->slots[slot].element);
+    cache->bytes -= cache->slots[slot].size;
+    cache->count--;
+    LRU_ClearSlot(cache, slot);
+}
+
+/**
+ * @brief Initializes an empty cache.
+ *
+ * @param cache Pointer to the cache structure to be initialized.
+ * @param maxEntries Highest number of entries, or 0 for no limit.
+ * @param maxBytes Highest sum of the sizes given to LRU_Put, or 0 for no limit.
+ *
+ * @post The cache is empty and its counters are zero. If the table cannot be allocated,
+ *       DLL_Error is called and the cache must not be used.
+ *
+ * @return This function does not return a value.
+ */
+void LRU_Init(LRUCache *cache, size_t maxEntries, size_t maxBytes) {
+
+    DLLPool_Init(&cache->pool, 1024);
+    XDLL_InitPooled(&cache->order, &cache->pool);
+    cache->slots = NULL;
+    cache->count = 0;
+    cache->maxEntries = maxEntries;
+    cache->maxBytes = maxBytes;
+    cache->bytes = 0;
+    cache->hits = cache->misses = cache->evictions = 0;
+
+    // Room for one entry over the limit, which exists until the eviction
+    size_t slotCount = LRU_INITIAL_SLOTS;
+    while (maxEntries > 0 && slotCount < 2 * (maxEntries + 1)) {
+        slotCount *= 2;
+    }
+    if (!LRU_Resize(cache, slotCount)) {
+        DLL_Error();
+    }
+}
+
+/**
+ * @brief Releases all entries and the hash table.
+ *
+ * @param cache Pointer to the initialized cache.
+ *
+ * @post The cache must be initialized again before further use.
+ *
+ * @return This function does not return a value.
+ */
+void LRU_Dispose(LRUCache *cache) {
+
+    XDLL_Dispose(&cache->order);
+    DLLPool_Dispose(&cache->pool);
+    free(cache->slots);
+    cache->slots = NULL;
+    cache->count = 0;
+    cache->bytes = 0;
+}
+
+/**
+ * @brief Looks up the value of a key.
+ *
+ * @param cache Pointer to the initialized cache.
+ * @param key Key to look for.
+ * @param valuePtr Pointer to the variable receiving the value.
+ *
+ * @post On a hit, the entry becomes the most recently used one and the hit counter is
+ *       incremented; otherwise the miss counter is incremented and the variable is left
+ *       untouched.
+ *
+ * @retval int TRUE if the key was found, FALSE otherwise.
+ */
+int LRU_Get(LRUCache *cache, int key, int *valuePtr) {
+
+    LRUEntry *entry = &cache->slots[LRU_FindSlot(cache, key)];
+    if (entry->element == NULL) {
+        cache->misses++;
+        return FALSE;
+    }
+    cache->hits++;
+    XDLL_MoveToFirst(&cache->order, entry->element);
+    *valuePtr = entry->value;
+    return TRUE;
+}
+
+/**
+ * @brief Inserts or updates the entry of a key.
+ *
+ * @details After the entry is stored, the least recently used entries are evicted until
+ *          the cache is within both limits again. An entry larger than 'maxBytes' on its
+ *          own is therefore evicted right away, after all others.
+ *
+ * @param cache Pointer to the initialized cache.
+ * @param key Key of the entry.
+ * @param value Value to cache.
+ * @param size Size of the entry counted against 'maxBytes', may be 0.
+ *
+ * @post The entry is the most recently used one. If the memory cannot be allocated,
+ *       DLL_Error is called and a new entry is not inserted.
+ *
+ * @return This function does not return a value.
+ */
+void LRU_Put(LRUCache *cache, int key, int value, size_t size) {
+
+    size_t slot = LRU_FindSlot(cache, key);
+    LRUEntry *entry = &cache->slots[slot];
+    if (entry->element != NULL) {
+        XDLL_MoveToFirst(&cache->order, entry->element);
+        cache->bytes += size - entry->size;
+        entry->value = value;
+        entry->size = size;
+    } else {
+        // Only a cache without an entry limit grows its table, once half full
+        if (2 * (cache->count + 1) > cache->slotMask + 1) {
+            if (!LRU_Resize(cache, 2 * (cache->slotMask + 1))) {
+                DLL_Error();
+                return;
+            }
+            slot = LRU_FindSlot(cache, key);
+        }
+        int length = cache->order.length;
+        XDLL_InsertFirst(&cache->order, key);
+        if (cache->order.length == length) {
+            return;
+        }
+        cache->slots[slot] = (LRUEntry) { key, value, size, cache->order.base.firstElement };
+        cache->count++;
+        cache->bytes += size;
+    }
+
+    while (cache->count > 0 && ((cache->maxEntries > 0 && cache->count > cache->maxEntries) ||
+                                (cache->maxBytes > 0 && cache->bytes > cache->maxBytes))) {
+        LRU_DeleteSlot(cache, LRU_FindSlot(cache, cache->order.base.lastElement->data));
+        cache->evictions++;
+    }
+}
+
+/**
+ * @brief Deletes the entry of a key.
+ *
+ * @param cache Pointer to the initialized cache.
+ * @param key Key of the entry.
+ *
+ * @retval int TRUE if the entry was deleted, FALSE if the key was not in the cache.
+ */
+int LRU_Remove(LRUCache *cache, int key) {
+
+    size_t slot = LRU_FindSlot(cache, key);
+    if (cache->slots[slot].element == NULL) {
+        return FALSE;
+    }
+    LRU_DeleteSlot(cache, slot);
+    return TRUE;
+}
+
+/**
+ * @brief Returns the number of entries in the cache.
+ *
+ * @param cache Pointer to the initialized cache.
+ *
+ * @retval size_t Number of entries.
+ */
+size_t LRU_Count(LRUCache *cache) {
+
+    return cache->count;
+}
+
+/* End of c206-lru.c */
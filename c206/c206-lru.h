@@ -0,0 +1,84 @@
+/**
+ * @file c206-lru.h
+ * @brief Least-recently-used cache built on the c206 list.
+ * @details Declares a cache of integer values under integer keys that keeps at most a
+ *          given number of entries, or of bytes as accounted by the caller, and evicts
+ *          the entries that were used least recently when it is full.
+ *
+ *          The recency order is a pooled XDLList of the keys, the most recently used
+ *          first. An open-addressing hash table maps every key to its list element, so
+ *          a lookup does not walk the list: a hit moves the element to the front with
+ *          XDLL_MoveToFirst and an eviction deletes the last element and its table entry,
+ *          all in constant time.
+ *
+ *          The table uses linear probing, and deletion shifts the following entries of
+ *          the probe sequence back, so it never fills up with deletion markers.
+ *
+ * @note The cache contains its list and pool, so the structure must not be copied or
+ *       moved between LRU_Init and LRU_Dispose.
+ *
+ * @see c206-ext.h for the list.
+ *
+ * @see https://github.com/Jekwwer/IAL-Project01-2021 for the project repository.
+ */
+
+#ifndef _LRU_H_
+#define _LRU_H_
+
+#include <stddef.h>
+
+#include "c206-ext.h"
+
+/** Slot of the hash table. */
+typedef struct {
+	/** Key of the entry, also stored in the list element. */
+	int key;
+	/** Cached value. */
+	int value;
+	/** Size of the entry in bytes as given by the caller. */
+	size_t size;
+	/** Element of the key in the recency list, or NULL if the slot is empty. */
+	DLLElementPtr element;
+} LRUEntry;
+
+/** Least-recently-used cache. */
+typedef struct {
+	/** Keys from the most to the least recently used. */
+	XDLList order;
+	/** Pool providing the elements of 'order'. */
+	DLLPool pool;
+	/** Hash table, its size is a power of two. */
+	LRUEntry *slots;
+	/** Size of the hash table minus one. */
+	size_t slotMask;
+	/** Number of entries. */
+	size_t count;
+	/** Highest number of entries, or 0 for no limit. */
+	size_t maxEntries;
+	/** Highest sum of the entry sizes, or 0 for no limit. */
+	size_t maxBytes;
+	/** Sum of the entry sizes. */
+	size_t bytes;
+	/** Number of lookups that found their key. */
+	unsigned long long hits;
+	/** Number of lookups that did not find their key. */
+	unsigned long long misses;
+	/** Number of entries evicted to stay within the limits. */
+	unsigned long long evictions;
+} LRUCache;
+
+void LRU_Init( LRUCache *, size_t, size_t );
+
+void LRU_Dispose( LRUCache * );
+
+int LRU_Get( LRUCache *, int, int * );
+
+void LRU_Put( LRUCache *, int, int, size_t );
+
+int LRU_Remove( LRUCache *, int );
+
+size_t LRU_Count( LRUCache * );
+
+#endif
+
+/* End of c206-lru.h */
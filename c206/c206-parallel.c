@@ -0,0 +1,425 @@
+/**
+ * @file c206-parallel.c
+ * @brief Parallel list operations implementation file.
+ * @details Implements the operations declared in c206-parallel.h. Every operation fills
+ *          in one task per segment, starts a thread for every segment but the first,
+ *          works on the first segment itself and joins the threads. A segment whose
+ *          thread cannot be created is processed by the calling thread afterwards, so
+ *          the operations do not fail for lack of threads.
+ *
+ *          The workers only touch the elements of their own segments.
+ *          XDLL_ParallelFilter relinks the kept elements of each segment into a chain of
+ *          their own and the calling thread joins the chains together, so no two threads
+ *          ever write the same element. The calling thread also does everything that involves shared
+ *          state: the pool's free list, the cursors and the list structure itself.
+ *
+ *          The functions implemented are:
+ *          - DLLSegments_Init:     Splits a list into segments of nearly equal length.
+ *          - DLLSegments_Dispose:  Releases the index.
+ *          - XDLL_ParallelForEach: Calls a function on every value.
+ *          - XDLL_ParallelReduce:  Combines all values into one.
+ *          - XDLL_ParallelFilter:  Deletes the elements whose values do not match.
+ *
+ * @code
+ * // Using example
+ * DLLSegments segments;
+ * DLLSegments_Init(&segments, &list, 32);
+ * long long sum = XDLL_ParallelReduce(&segments, DLL_REDUCE_SUM);
+ * XDLL_ParallelFilter(&segments, is_valid, NULL);
+ * long long max = XDLL_ParallelReduce(&segments, DLL_REDUCE_MAX);
+ * DLLSegments_Dispose(&segments);
+ * @endcode
+ *
+ * @see c206-parallel.h for type definitions.
+ *
+ * @see https://github.com/Jekwwer/IAL-Project01-2021 for the project repository.
+ */
+
+#include "c206-parallel.h"
+
+/** Work on one segment and its results. */
+typedef struct DLLSegmentTask {
+	/** Index the segment belongs to. */
+	DLLSegments *segments;
+	/** Number of the segment. */
+	int index;
+	/** Function called on the values by XDLL_ParallelForEach. */
+	void (*function)( int *, void * );
+	/** Function choosing the values kept by XDLL_ParallelFilter. */
+	int (*predicate)( int, void * );
+	/** Pointer passed to 'function' or 'predicate'. */
+	void *context;
+	/** Combination computed by XDLL_ParallelReduce. */
+	DLLReduction reduction;
+	/** Combination of the values of the segment. */
+	long long result;
+	/** Last element kept by the filter. */
+	DLLElementPtr lastKept;
+	/** Elements removed by the filter and not freed yet, linked through nextElement. */
+	DLLElementPtr removed;
+	/** Last element of 'removed'. */
+	DLLElementPtr lastRemoved;
+	/** Number of elements removed by the filter. */
+	int removedCount;
+	/** Position of the active element among the kept elements, -1 if not in the segment. */
+	int activeIndex;
+	/** Nonzero if the filter removed the active element. */
+	int activeRemoved;
+	/** Thread working on the segment. */
+	pthread_t thread;
+	/** Nonzero if 'thread' was started. */
+	int started;
+} DLLSegmentTask;
+
+/**
+ * @brief Runs 'work' on every task, one thread per segment.
+ *
+ * @param segments Pointer to the index whose tasks are filled in.
+ * @param work Function processing one task.
+ */
+static void DLLSegments_Run(DLLSegments *segments, void *(*work)(void *)) {
+
+    for (int i = 1; i < segments->count; i++) {
+        DLLSegmentTask *task = &segments->tasks[i];
+        task->started = pthread_create(&task->thread, NULL, work, task) == 0;
+    }
+    work(&segments->tasks[0]);
+    for (int i = 1; i < segments->count; i++) {
+        DLLSegmentTask *task = &segments->tasks[i];
+        if (task->started) {
+            pthread_join(task->thread, NULL);
+        } else {
+            work(task);
+        }
+    }
+}
+
+/**
+ * @brief Splits a list into segments of nearly equal length.
+ *
+ * @details The list is walked once and the first element of every segment remembered.
+ *          A list shorter than 'count' gets one segment per element, an empty list one
+ *          empty segment.
+ *
+ * @param segments Pointer to the index structure to be initialized.
+ * @param list Pointer to the initialized list to split.
+ * @param count Number of segments, and therefore of threads used by the operations.
+ *
+ * @post The index describes the current structure of the list. If the memory cannot be
+ *       allocated, DLL_Error is called and the index has no segments, which the
+ *       operations treat as an empty list.
+ *
+ * @return This function does not return a value.
+ */
+void DLLSegments_Init(DLLSegments *segments, XDLList *list, int count) {
+
+    if (count > list->length) {
+        count = list->length;
+    }
+    if (count < 1) {
+        count = 1;
+    }
+
+    segments->list = list;
+    segments->firstElements = (DLLElementPtr *) malloc(sizeof(DLLElementPtr) * count);
+    segments->lengths = (int *) malloc(sizeof(int) * count);
+    segments->tasks = (DLLSegmentTask *) malloc(sizeof(DLLSegmentTask) * count);
+    if (segments->firstElements == NULL || segments->lengths == NULL || segments->tasks == NULL) {
+        DLLSegments_Dispose(segments);
+        DLL_Error();
+        return;
+    }
+    segments->count = count;
+
+    DLLElementPtr element = list->base.firstElement;
+    for (int i = 0; i < count; i++) {
+        // Spread the remainder over the first segments
+        int length = list->length / count + (i < list->length % count);
+        segments->firstElements[i] = length > 0 ? element : NULL;
+        segments->lengths[i] = length;
+        for (int j = 0; j < length; j++) {
+            element = element->nextElement;
+        }
+    }
+}
+
+/**
+ * @brief Releases the index.
+ *
+ * @param segments Pointer to the index.
+ *
+ * @post The index has no segments. The list is not affected.
+ *
+ * @return This function does not return a value.
+ */
+void DLLSegments_Dispose(DLLSegments *segments) {
+
+    free(segments->firstElements);
+    free(segments->lengths);
+    free(segments->tasks);
+    segments->firstElements = NULL;
+    segments->lengths = NULL;
+    segments->tasks = NULL;
+    segments->count = 0;
+}
+
+/** Calls the task's function on every value of its segment. */
+static void *XDLL_ForEachWorker(void *arg) {
+
+    DLLSegmentTask *task = arg;
+    DLLElementPtr element = task->segments->firstElements[task->index];
+    for (int i = task->segments->lengths[task->index]; i > 0; i--) {
+        task->function(&element->data, task->context);
+        element = element->nextElement;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Calls a function on every value of the list, one thread per segment.
+ *
+ * @param segments Pointer to an index valid for the current structure of the list.
+ * @param function Function receiving a pointer to each value and 'context'. It may
+ *                 change the value, but it is called concurrently and in no particular
+ *                 order across the segments.
+ * @param context Pointer passed to every call of 'function', may be NULL.
+ *
+ * @return This function does not return a value.
+ */
+void XDLL_ParallelForEach(DLLSegments *segments, void (*function)(int *, void *), void *context) {
+
+    for (int i = 0; i < segments->count; i++) {
+        segments->tasks[i] = (DLLSegmentTask) { .segments = segments, .index = i,
+                                                .function = function, .context = context };
+    }
+    if (segments->count > 0) {
+        DLLSegments_Run(segments, XDLL_ForEachWorker);
+    }
+}
+
+/** Combines the values of the task's segment, leaving empty segments alone. */
+static void *XDLL_ReduceWorker(void *arg) {
+
+    DLLSegmentTask *task = arg;
+    DLLElementPtr element = task->segments->firstElements[task->index];
+    if (element == NULL) {
+        return NULL;
+    }
+    long long result = task->reduction == DLL_REDUCE_SUM ? 0 : element->data;
+    for (int i = task->segments->lengths[task->index]; i > 0; i--) {
+        switch (task->reduction) {
+            case DLL_REDUCE_SUM:
+                result += element->data;
+                break;
+            case DLL_REDUCE_MIN:
+                if (element->data < result) {
+                    result = element->data;
+                }
+                break;
+            case DLL_REDUCE_MAX:
+                if (element->data > result) {
+                    result = element->data;
+                }
+                break;
+        }
+        element = element->nextElement;
+    }
+    task->result = result;
+    return NULL;
+}
+
+/**
+ * @brief Combines all values of the list into one, one thread per segment.
+ *
+ * @param segments Pointer to an index valid for the current structure of the list.
+ * @param reduction Combination to compute: DLL_REDUCE_SUM, DLL_REDUCE_MIN or
+ *                  DLL_REDUCE_MAX.
+ *
+ * @retval long long The same value as XDLL_Reduce: the sum, which is 0 for an empty list,
+ *                   or the smallest or largest value. For the smallest and largest
+ *                   values of an empty list, DLL_Error is called and 0 is returned.
+ */
+long long XDLL_ParallelReduce(DLLSegments *segments, DLLReduction reduction) {
+
+    if (segments->count == 0 || segments->list->length == 0) {
+        if (reduction != DLL_REDUCE_SUM) {
+            DLL_Error();
+        }
+        return 0;
+    }
+
+    for (int i = 0; i < segments->count; i++) {
+        segments->tasks[i] = (DLLSegmentTask) { .segments = segments, .index = i,
+                                                .reduction = reduction };
+    }
+    DLLSegments_Run(segments, XDLL_ReduceWorker);
+
+    // Filtering may have emptied some of the segments
+    long long result = 0;
+    int combined = FALSE;
+    for (int i = 0; i < segments->count; i++) {
+        if (segments->lengths[i] == 0) {
+            continue;
+        }
+        long long partial = segments->tasks[i].result;
+        if (!combined || reduction == DLL_REDUCE_SUM) {
+            result = combined ? result + partial : partial;
+        } else if (reduction == DLL_REDUCE_MIN ? partial < result : partial > result) {
+            result = partial;
+        }
+        combined = TRUE;
+    }
+    return result;
+}
+
+/**
+ * @brief Relinks the matching elements of the task's segment into a chain.
+ *
+ * @details Elements of a list without a pool and without cursors are freed right away,
+ *          the others are collected for the calling thread.
+ */
+static void *XDLL_FilterWorker(void *arg) {
+
+    DLLSegmentTask *task = arg;
+    DLLSegments *segments = task->segments;
+    XDLList *list = segments->list;
+    int freeHere = list->pool == NULL && list->cursors == NULL;
+
+    DLLElementPtr element = segments->firstElements[task->index];
+    DLLElementPtr firstKept = NULL;
+    int kept = 0;
+    for (int i = segments->lengths[task->index]; i > 0; i--) {
+        // The successor of the last element belongs to the next segment, do not touch it
+        DLLElementPtr next = i > 1 ? element->nextElement : NULL;
+        if (task->predicate(element->data, task->context)) {
+            if (element == list->base.activeElement) {
+                task->activeIndex = kept;
+            }
+            if (task->lastKept != NULL) {
+                task->lastKept->nextElement = element;
+                element->previousElement = task->lastKept;
+            } else {
+                firstKept = element;
+            }
+            task->lastKept = element;
+            kept++;
+        } else {
+            if (element == list->base.activeElement) {
+                task->activeRemoved = TRUE;
+            }
+            if (freeHere) {
+                free(element);
+            } else {
+                element->nextElement = task->removed;
+                if (task->removed == NULL) {
+                    task->lastRemoved = element;
+                }
+                task->removed = element;
+            }
+            task->removedCount++;
+        }
+        element = next;
+    }
+
+    segments->firstElements[task->index] = firstKept;
+    segments->lengths[task->index] = kept;
+    return NULL;
+}
+
+/**
+ * @brief Deletes every element whose value does not match, one thread per segment.
+ *
+ * @details Each worker unlinks the elements of its segment that do not match and links
+ *          the matching ones together, then the calling thread stitches the segments'
+ *          chains back into one list and releases the removed elements.
+ *
+ * @param segments Pointer to an index valid for the current structure of the list.
+ * @param predicate Function returning nonzero for the values to keep. It receives each
+ *                  value and 'context' and is called concurrently.
+ * @param context Pointer passed to every call of 'predicate', may be NULL.
+ *
+ * @post The list holds the matching values in their previous order and the index
+ *       describes its new structure, with the segments shrunk accordingly. If the active
+ *       element was deleted, the list is inactive; cursors on deleted elements are
+ *       deactivated.
+ *
+ * @retval int Number of deleted elements.
+ */
+int XDLL_ParallelFilter(DLLSegments *segments, int (*predicate)(int, void *), void *context) {
+
+    if (segments->count == 0) {
+        return 0;
+    }
+    XDLList *list = segments->list;
+
+    for (int i = 0; i < segments->count; i++) {
+        segments->tasks[i] = (DLLSegmentTask) { .segments = segments, .index = i,
+                                                .predicate = predicate, .context = context,
+                                                .activeIndex = -1 };
+    }
+    DLLSegments_Run(segments, XDLL_FilterWorker);
+
+    DLLElementPtr previous = NULL;
+    int position = 0;
+    int removedCount = 0;
+    list->base.firstElement = NULL;
+    for (int i = 0; i < segments->count; i++) {
+        DLLSegmentTask *task = &segments->tasks[i];
+
+        // Stitch the chain of the segment to the chains before it
+        if (task->lastKept != NULL) {
+            DLLElementPtr first = segments->firstElements[i];
+            first->previousElement = previous;
+            if (previous != NULL) {
+                previous->nextElement = first;
+            } else {
+                list->base.firstElement = first;
+            }
+            previous = task->lastKept;
+        }
+        if (task->activeRemoved) {
+            list->base.activeElement = NULL;
+            list->activePosition = -1;
+        } else if (task->activeIndex >= 0) {
+            list->activePosition = position + task->activeIndex;
+        }
+        position += segments->lengths[i];
+
+        // Release what the worker could not free itself
+        for (XDLLCursor *cursor = list->cursors; cursor != NULL && task->removed != NULL;
+             cursor = cursor->nextCursor) {
+            for (DLLElementPtr element = task->removed; element != NULL; element = element->nextElement) {
+                if (cursor->element == element) {
+                    cursor->element = NULL;
+                }
+            }
+        }
+        if (task->removed != NULL && list->pool != NULL) {
+            task->lastRemoved->nextElement = list->pool->freeElements;
+            list->pool->freeElements = task->removed;
+            list->pool->freeCount += task->removedCount;
+        } else {
+            while (task->removed != NULL) {
+                DLLElementPtr next = task->removed->nextElement;
+                free(task->removed);
+                task->removed = next;
+            }
+        }
+        removedCount += task->removedCount;
+    }
+    if (previous != NULL) {
+        previous->nextElement = NULL;
+    }
+    list->base.lastElement = previous;
+    list->length -= removedCount;
+    if (list->compactThreshold > 0) {
+        list->churn += removedCount;
+    }
+    if (list->seekIndex != NULL) {
+        // Elements went missing all over the list, sample it anew
+        XDLL_SetSeekIndex(list, list->seekIndex->stride);
+    }
+    return removedCount;
+}
+
+/* End of c206-parallel.c */
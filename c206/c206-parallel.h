@@ -0,0 +1,60 @@
+/**
+ * @file c206-parallel.h
+ * @brief Parallel operations over large c206 lists.
+ * @details Declares operations that process an XDLList on several threads at once. A
+ *          list can only be walked from one end, so the work is split with an index of
+ *          segments: DLLSegments_Init walks the list once and remembers where each of N
+ *          segments of nearly equal length starts. Every parallel operation then runs
+ *          one thread per segment, each walking only its own elements, and combines the
+ *          results of the segments on the calling thread.
+ *
+ *          Building the index costs one sequential walk, so it pays off when several
+ *          operations run over the same index or when the work per element outweighs
+ *          following a link. XDLL_ParallelFilter keeps the index valid, any other change
+ *          of the list structure (inserting, deleting, sorting, compacting by
+ *          XDLL_Compact or by an XDLL_MaybeCompact that returns TRUE) invalidates it, and
+ *          the index must then be built again.
+ *
+ * @note The functions called on the values run concurrently and must not touch the list;
+ *       the calling thread takes part as the worker of the first segment.
+ *
+ * @see c206-ext.h for the list and XDLL_ForEach, XDLL_Reduce, their sequential
+ *      counterparts.
+ *
+ * @see https://github.com/Jekwwer/IAL-Project01-2021 for the project repository.
+ */
+
+#ifndef _PARDLL_H_
+#define _PARDLL_H_
+
+#include <pthread.h>
+
+#include "c206-ext.h"
+
+/** Index splitting a list into segments processed in parallel. */
+typedef struct {
+	/** List the index belongs to. */
+	XDLList *list;
+	/** Number of segments, zero if the index could not be allocated. */
+	int count;
+	/** First element of every segment, NULL for an empty segment. */
+	DLLElementPtr *firstElements;
+	/** Number of elements in every segment. */
+	int *lengths;
+	/** Work descriptions of the segments, reused by every operation. */
+	struct DLLSegmentTask *tasks;
+} DLLSegments;
+
+void DLLSegments_Init( DLLSegments *, XDLList *, int );
+
+void DLLSegments_Dispose( DLLSegments * );
+
+void XDLL_ParallelForEach( DLLSegments *, void (*)( int *, void * ), void * );
+
+long long XDLL_ParallelReduce( DLLSegments *, DLLReduction );
+
+int XDLL_ParallelFilter( DLLSegments *, int (*)( int, void * ), void * );
+
+#endif
+
+/* End of c206-parallel.h */
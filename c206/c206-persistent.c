@@ -0,0 +1,755 @@
+/**
+ * @file c206-persistent.c
+ * @brief Implementation of the persistent doubly linked list.
+ * @details Implements the PDLL_* operations declared in c206-persistent.h. As in
+ *          c206-compact.c, every insertion goes through PDLL_Link and every deletion
+ *          through PDLL_Unlink, and these two functions are where the order of the
+ *          stores matters:
+ *
+ *          - PDLL_Link fills the slot, persists it, then stores the slot index into the
+ *            next link of the predecessor (or the first index of the header) and
+ *            persists that store. The previous link of the successor follows.
+ *          - PDLL_Unlink stores the successor's index into the next link of the
+ *            predecessor and persists it before the slot goes to the free list, where
+ *            its next link is overwritten and it may be reused.
+ *
+ *          Persisting is a compiler barrier, and with PDLL_DURABLE an msync of the pages
+ *          holding the stored bytes. The file grows by doubling the number of slots;
+ *          the file is extended first and mapped anew, and since links are indices, the
+ *          new mapping needs no fix-up.
+ *
+ * @code
+ * // Example usage:
+ * PDLList list;
+ * if (PDLL_Open(&list, "list.pdl", 0)) {
+ *     PDLL_InsertLast(&list, 42);
+ *     PDLL_Close(&list);
+ * }
+ * // After a restart, the value is still there
+ * PDLL_Open(&list, "list.pdl", 0);
+ * @endcode
+ *
+ * @see c206-persistent.h for definition of constants and types.
+ *
+ * @see https://github.com/Jekwwer/IAL-Project01-2021 for the project repository.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "c206-persistent.h"
+
+#include <fcntl.h>
+#include <stdatomic.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/** Number of slots of a newly created file. */
+#define PDLL_INITIAL_CAPACITY 1024
+
+_Static_assert(sizeof(PDLLHeader) <= PDLL_HEADER_SIZE, "the header must fit before the slots");
+
+/**
+ * @brief Returns the size of a file holding the given number of slots.
+ *
+ * @param capacity Number of slots.
+ *
+ * @retval size_t Size of the file in bytes.
+ */
+static size_t PDLL_FileSize(uint32_t capacity) {
+
+    return PDLL_HEADER_SIZE + (size_t) capacity * sizeof(PDLLNode);
+}
+
+/**
+ * @brief Makes the preceding stores reach the file before any following one.
+ *
+ * @details The compiler barrier keeps the stores in program order, which is all that a
+ *          crash of the process can observe. A durable list also waits until the pages
+ *          holding the given bytes are written to the disk.
+ *
+ * @param list Pointer to the open list.
+ * @param address First byte that has to be persisted.
+ * @param size Number of bytes.
+ */
+static void PDLL_Persist(PDLList *list, const void *address, size_t size) {
+
+    atomic_signal_fence(memory_order_seq_cst);
+    if (list->durable) {
+        uintptr_t start = (uintptr_t) address & ~(uintptr_t) (list->pageSize - 1);
+        msync((void *) start, (uintptr_t) address + size - start, MS_SYNC);
+    }
+}
+
+/**
+ * @brief Maps the first 'size' bytes of the file in place of the current mapping.
+ *
+ * @param list Pointer to the list with an open file.
+ * @param size Size of the new mapping.
+ *
+ * @retval int TRUE on success, FALSE if the file could not be mapped, in which case the
+ *             current mapping is kept.
+ */
+static int PDLL_Map(PDLList *list, size_t size) {
+
+    void *map = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, list->fd, 0);
+    if (map == MAP_FAILED) {
+        return FALSE;
+    }
+    if (list->header != NULL) {
+        munmap(list->header, list->mappedSize);
+    }
+    list->header = (PDLLHeader *) map;
+    list->nodes = (PDLLNode *) ((char *) map + PDLL_HEADER_SIZE);
+    list->mappedSize = size;
+    return TRUE;
+}
+
+/**
+ * @brief Doubles the number of slots of the file.
+ *
+ * @details The file is extended before the header records the new capacity, so a crash
+ *          in between leaves only unused space at the end of the file. The capacity is
+ *          persisted before any new slot can be linked; a durable list also waits until
+ *          the new size of the file is on the disk.
+ *
+ * @param list Pointer to the open list.
+ *
+ * @retval int TRUE on success, FALSE if the file could not grow.
+ */
+static int PDLL_Grow(PDLList *list) {
+
+    uint32_t capacity = list->header->capacity;
+    // The last index is reserved for PDLL_NONE
+    if (capacity == PDLL_NONE - 1) {
+        return FALSE;
+    }
+    capacity = capacity > (PDLL_NONE - 1) / 2 ? PDLL_NONE - 1 : capacity * 2;
+    size_t size = PDLL_FileSize(capacity);
+    if (ftruncate(list->fd, (off_t) size) != 0 || (list->durable && fsync(list->fd) != 0) ||
+        !PDLL_Map(list, size)) {
+        return FALSE;
+    }
+    list->header->capacity = capacity;
+    PDLL_Persist(list, &list->header->capacity, sizeof(uint32_t));
+    return TRUE;
+}
+
+/**
+ * @brief Writes the header of an empty list into a new file.
+ *
+ * @details The magic is written last, so a crash before it leaves a header that is still
+ *          all zeroes, which PDLL_Open initializes again.
+ *
+ * @param list Pointer to the list with an open file.
+ *
+ * @retval int TRUE on success, FALSE if the file could not be extended or mapped.
+ */
+static int PDLL_Create(PDLList *list) {
+
+    size_t size = PDLL_FileSize(PDLL_INITIAL_CAPACITY);
+    if (ftruncate(list->fd, (off_t) size) != 0 || !PDLL_Map(list, size)) {
+        return FALSE;
+    }
+    PDLLHeader *header = list->header;
+    memset(header, 0, sizeof(PDLLHeader));
+    header->byteOrder = PDLL_BYTE_ORDER;
+    header->version = PDLL_VERSION;
+    header->capacity = PDLL_INITIAL_CAPACITY;
+    header->used = 0;
+    header->firstIndex = header->lastIndex = header->freeIndex = PDLL_NONE;
+    header->length = 0;
+    header->clean = FALSE;
+    PDLL_Persist(list, header, sizeof(PDLLHeader));
+    memcpy(header->magic, PDLL_MAGIC, sizeof(PDLL_MAGIC));
+    PDLL_Persist(list, header, sizeof(PDLLHeader));
+    return TRUE;
+}
+
+/**
+ * @brief Checks whether a file holds nothing but an unwritten header.
+ *
+ * @details A crash while PDLL_Create runs leaves the file extended but its header still
+ *          zero, or shorter than a header; such a file never held any element.
+ *
+ * @param fd Descriptor of the open file.
+ * @param size Size of the file in bytes.
+ *
+ * @retval int TRUE if the file is empty or its first PDLL_HEADER_SIZE bytes are zero.
+ */
+static int PDLL_IsUnwritten(int fd, size_t size) {
+
+    static const unsigned char zeroes[PDLL_HEADER_SIZE];
+    unsigned char bytes[PDLL_HEADER_SIZE];
+    size_t count = size < PDLL_HEADER_SIZE ? size : PDLL_HEADER_SIZE;
+    return pread(fd, bytes, count, 0) == (ssize_t) count && memcmp(bytes, zeroes, count) == 0;
+}
+
+/**
+ * @brief Obtains a free slot, growing the file when needed.
+ *
+ * @param list Pointer to the open list.
+ *
+ * @retval uint32_t Index of the slot, or PDLL_NONE if the file could not grow.
+ */
+static uint32_t PDLL_AllocSlot(PDLList *list) {
+
+    PDLLHeader *header = list->header;
+    if (header->freeIndex != PDLL_NONE) {
+        uint32_t slot = header->freeIndex;
+        header->freeIndex = list->nodes[slot].nextIndex;
+        return slot;
+    }
+    if (header->used == header->capacity && !PDLL_Grow(list)) {
+        return PDLL_NONE;
+    }
+    return list->header->used++;
+}
+
+/**
+ * @brief Links a slot with data between two neighbouring elements.
+ *
+ * @param list Pointer to the open list.
+ * @param data Value of the new element.
+ * @param previousIndex Element the new one follows, or PDLL_NONE to insert it first.
+ * @param nextIndex Element the new one precedes, or PDLL_NONE to insert it last.
+ *
+ * @post The element is linked, or DLL_Error is called if no slot could be obtained.
+ */
+static void PDLL_Link(PDLList *list, int data, uint32_t previousIndex, uint32_t nextIndex) {
+
+    uint32_t slot = PDLL_AllocSlot(list);
+    if (slot == PDLL_NONE) {
+        DLL_Error();
+        return;
+    }
+
+    PDLLNode *node = &list->nodes[slot];
+    node->data = data;
+    node->previousIndex = previousIndex;
+    node->nextIndex = nextIndex;
+    PDLL_Persist(list, node, sizeof(PDLLNode));
+
+    // The element becomes part of the list with this single store
+    uint32_t *link = previousIndex != PDLL_NONE ? &list->nodes[previousIndex].nextIndex
+                                                : &list->header->firstIndex;
+    *link = slot;
+    PDLL_Persist(list, link, sizeof(uint32_t));
+
+    if (nextIndex != PDLL_NONE) {
+        list->nodes[nextIndex].previousIndex = slot;
+    } else {
+        list->header->lastIndex = slot;
+    }
+    list->header->length++;
+}
+
+/**
+ * @brief Unlinks an element and recycles its slot.
+ *
+ * @param list Pointer to the open list.
+ * @param slot Index of the element to delete.
+ *
+ * @post The element is removed; if it was active, the list becomes inactive.
+ */
+static void PDLL_Unlink(PDLList *list, uint32_t slot) {
+
+    PDLLNode *node = &list->nodes[slot];
+
+    // The element leaves the list with this single store
+    uint32_t *link = node->previousIndex != PDLL_NONE ? &list->nodes[node->previousIndex].nextIndex
+                                                      : &list->header->firstIndex;
+    *link = node->nextIndex;
+    PDLL_Persist(list, link, sizeof(uint32_t));
+
+    if (node->nextIndex != PDLL_NONE) {
+        list->nodes[node->nextIndex].previousIndex = node->previousIndex;
+    } else {
+        list->header->lastIndex = node->previousIndex;
+    }
+    if (list->activeIndex == slot) {
+        list->activeIndex = PDLL_NONE;
+    }
+    list->header->length--;
+
+    node->nextIndex = list->header->freeIndex;
+    list->header->freeIndex = slot;
+}
+
+/**
+ * @brief Opens the list stored in a file, creating the file if it does not exist.
+ *
+ * @details Opening a file that was closed by PDLL_Close only maps it, whatever the
+ *          length of the list. A file that was not closed is recovered first. A file
+ *          whose header is still all zeroes, left by a crash while the file was being
+ *          created, is initialized like a new one.
+ *
+ * @param list Pointer to the list structure to be initialized.
+ * @param path Path of the file.
+ * @param flags PDLL_DURABLE to flush every link update to the disk, or 0.
+ *
+ * @post On success the list holds what the file holds and is inactive.
+ *
+ * @retval int TRUE on success, FALSE if the file cannot be opened, created or mapped,
+ *             or is not a persistent list file of this machine.
+ */
+int PDLL_Open(PDLList *list, const char *path, int flags) {
+
+    list->header = NULL;
+    list->nodes = NULL;
+    list->mappedSize = 0;
+    list->durable = (flags & PDLL_DURABLE) != 0;
+    list->pageSize = (size_t) sysconf(_SC_PAGESIZE);
+    list->activeIndex = PDLL_NONE;
+    list->fd = open(path, O_RDWR | O_CREAT, 0644);
+    if (list->fd < 0) {
+        return FALSE;
+    }
+
+    struct stat status;
+    if (fstat(list->fd, &status) != 0) {
+        close(list->fd);
+        return FALSE;
+    }
+
+    if (PDLL_IsUnwritten(list->fd, (size_t) status.st_size)) {
+        // A new file, or one whose creation was interrupted
+        if (!PDLL_Create(list)) {
+            if (list->header != NULL) {
+                munmap(list->header, list->mappedSize);
+            }
+            close(list->fd);
+            return FALSE;
+        }
+        return TRUE;
+    }
+
+    const PDLLHeader *header = NULL;
+    if ((size_t) status.st_size >= PDLL_HEADER_SIZE && PDLL_Map(list, (size_t) status.st_size)) {
+        header = list->header;
+    }
+    if (header == NULL || memcmp(header->magic, PDLL_MAGIC, sizeof(PDLL_MAGIC)) != 0 ||
+        header->byteOrder != PDLL_BYTE_ORDER || header->version != PDLL_VERSION ||
+        header->capacity == PDLL_NONE || PDLL_FileSize(header->capacity) > (size_t) status.st_size) {
+        if (list->header != NULL) {
+            munmap(list->header, list->mappedSize);
+        }
+        close(list->fd);
+        return FALSE;
+    }
+
+    if (!list->header->clean) {
+        // The file is extended before a grow records the new capacity, so a capacity lost
+        // by a crash is recovered from the size of the file
+        size_t slots = ((size_t) status.st_size - PDLL_HEADER_SIZE) / sizeof(PDLLNode);
+        if (slots > PDLL_NONE - 1) {
+            slots = PDLL_NONE - 1;
+        }
+        if (slots > list->header->capacity) {
+            list->header->capacity = (uint32_t) slots;
+        }
+        PDLL_Recover(list);
+    }
+    // Any change from now on makes the derived data stale until PDLL_Close
+    list->header->clean = FALSE;
+    PDLL_Persist(list, &list->header->clean, sizeof(uint32_t));
+    return TRUE;
+}
+
+/**
+ * @brief Writes everything to the disk and closes the file.
+ *
+ * @param list Pointer to the open list.
+ *
+ * @post The file is marked as closed, so the next PDLL_Open skips the recovery. The
+ *       list must be opened again before further use.
+ *
+ * @return This function does not return a value.
+ */
+void PDLL_Close(PDLList *list) {
+
+    msync(list->header, list->mappedSize, MS_SYNC);
+    list->header->clean = TRUE;
+    msync(list->header, PDLL_HEADER_SIZE, MS_SYNC);
+    munmap(list->header, list->mappedSize);
+    close(list->fd);
+    list->header = NULL;
+    list->nodes = NULL;
+    list->mappedSize = 0;
+    list->fd = -1;
+    list->activeIndex = PDLL_NONE;
+}
+
+/**
+ * @brief Rebuilds the derived data from the chain of next links.
+ *
+ * @details The chain is walked from the first element, which repairs the previous links
+ *          and recomputes the last element and the length. Every slot the walk does not
+ *          reach becomes free, including a slot whose insertion was interrupted before
+ *          it was linked. A next link outside of the file or back to an element already
+ *          visited, which only a damaged file contains, ends the list there.
+ *
+ * @param list Pointer to the open list.
+ *
+ * @post The derived data is consistent with the chain, and the list is inactive. If the
+ *       memory for the walk cannot be allocated, DLL_Error is called and the list is
+ *       unchanged.
+ *
+ * @return This function does not return a value.
+ */
+void PDLL_Recover(PDLList *list) {
+
+    PDLLHeader *header = list->header;
+    unsigned char *reached = (unsigned char *) calloc(header->capacity / 8 + 1, 1);
+    if (reached == NULL) {
+        DLL_Error();
+        return;
+    }
+
+    uint32_t previous = PDLL_NONE;
+    uint32_t length = 0;
+    uint32_t used = header->used < header->capacity ? header->used : header->capacity;
+    uint32_t *link = &header->firstIndex;
+    while (*link != PDLL_NONE) {
+        uint32_t slot = *link;
+        if (slot >= header->capacity || reached[slot / 8] & (1u << (slot % 8))) {
+            *link = PDLL_NONE;
+            break;
+        }
+        reached[slot / 8] |= 1u << (slot % 8);
+        list->nodes[slot].previousIndex = previous;
+        if (slot >= used) {
+            used = slot + 1;
+        }
+        previous = slot;
+        length++;
+        link = &list->nodes[slot].nextIndex;
+    }
+    header->lastIndex = previous;
+    header->length = length;
+    header->used = used;
+
+    header->freeIndex = PDLL_NONE;
+    for (uint32_t slot = used; slot-- > 0;) {
+        if (!(reached[slot / 8] & (1u << (slot % 8)))) {
+            list->nodes[slot].nextIndex = header->freeIndex;
+            header->freeIndex = slot;
+        }
+    }
+    free(reached);
+
+    list->activeIndex = PDLL_NONE;
+    PDLL_Persist(list, header, list->mappedSize);
+}
+
+/**
+ * @brief Returns the number of elements in the list.
+ *
+ * @param list Pointer to the open list.
+ *
+ * @retval int Number of elements.
+ */
+int PDLL_Length(PDLList *list) {
+
+    return (int) list->header->length;
+}
+
+/**
+ * @brief Deletes all elements of the list.
+ *
+ * @details Clearing the first index removes all elements with a single store; the slots
+ *          are then all free again, and the file keeps its size.
+ *
+ * @param list Pointer to the open list.
+ *
+ * @post The list is empty and inactive.
+ *
+ * @return This function does not return a value.
+ */
+void PDLL_Dispose(PDLList *list) {
+
+    PDLLHeader *header = list->header;
+    header->firstIndex = PDLL_NONE;
+    PDLL_Persist(list, &header->firstIndex, sizeof(uint32_t));
+    header->lastIndex = header->freeIndex = PDLL_NONE;
+    header->used = 0;
+    header->length = 0;
+    list->activeIndex = PDLL_NONE;
+}
+
+/**
+ * @brief Inserts a new element at the beginning of the list.
+ *
+ * @param list Pointer to the open list.
+ * @param data Value to be inserted.
+ *
+ * @post If no slot can be obtained, DLL_Error is called and the list is unchanged.
+ *
+ * @return This function does not return a value.
+ */
+void PDLL_InsertFirst(PDLList *list, int data) {
+
+    PDLL_Link(list, data, PDLL_NONE, list->header->firstIndex);
+}
+
+/**
+ * @brief Inserts a new element at the end of the list.
+ *
+ * @param list Pointer to the open list.
+ * @param data Value to be inserted.
+ *
+ * @post If no slot can be obtained, DLL_Error is called and the list is unchanged.
+ *
+ * @return This function does not return a value.
+ */
+void PDLL_InsertLast(PDLList *list, int data) {
+
+    PDLL_Link(list, data, list->header->lastIndex, PDLL_NONE);
+}
+
+/**
+ * @brief Sets the first element of the list as active.
+ *
+ * @param list Pointer to the open list.
+ *
+ * @return This function does not return a value.
+ */
+void PDLL_First(PDLList *list) {
+
+    list->activeIndex = list->header->firstIndex;
+}
+
+/**
+ * @brief Sets the last element of the list as active.
+ *
+ * @param list Pointer to the open list.
+ *
+ * @return This function does not return a value.
+ */
+void PDLL_Last(PDLList *list) {
+
+    list->activeIndex = list->header->lastIndex;
+}
+
+/**
+ * @brief Returns the value of the first element.
+ *
+ * @param list Pointer to the open list.
+ * @param dataPtr Pointer to the destination variable.
+ *
+ * @post If the list is empty, DLL_Error is called and the variable is left untouched.
+ *
+ * @return This function does not return a value.
+ */
+void PDLL_GetFirst(PDLList *list, int *dataPtr) {
+
+    if (list->header->firstIndex == PDLL_NONE) {
+        DLL_Error();
+    } else {
+        *dataPtr = list->nodes[list->header->firstIndex].data;
+    }
+}
+
+/**
+ * @brief Returns the value of the last element.
+ *
+ * @param list Pointer to the open list.
+ * @param dataPtr Pointer to the destination variable.
+ *
+ * @post If the list is empty, DLL_Error is called and the variable is left untouched.
+ *
+ * @return This function does not return a value.
+ */
+void PDLL_GetLast(PDLList *list, int *dataPtr) {
+
+    if (list->header->lastIndex == PDLL_NONE) {
+        DLL_Error();
+    } else {
+        *dataPtr = list->nodes[list->header->lastIndex].data;
+    }
+}
+
+/**
+ * @brief Deletes the first element of the list.
+ *
+ * @param list Pointer to the open list.
+ *
+ * @post Nothing happens if the list is empty.
+ *
+ * @return This function does not return a value.
+ */
+void PDLL_DeleteFirst(PDLList *list) {
+
+    if (list->header->firstIndex != PDLL_NONE) {
+        PDLL_Unlink(list, list->header->firstIndex);
+    }
+}
+
+/**
+ * @brief Deletes the last element of the list.
+ *
+ * @param list Pointer to the open list.
+ *
+ * @post Nothing happens if the list is empty.
+ *
+ * @return This function does not return a value.
+ */
+void PDLL_DeleteLast(PDLList *list) {
+
+    if (list->header->lastIndex != PDLL_NONE) {
+        PDLL_Unlink(list, list->header->lastIndex);
+    }
+}
+
+/**
+ * @brief Deletes the element following the active one.
+ *
+ * @param list Pointer to the open list.
+ *
+ * @post Nothing happens if the list is inactive or the active element is the last one.
+ *
+ * @return This function does not return a value.
+ */
+void PDLL_DeleteAfter(PDLList *list) {
+
+    if (PDLL_IsActive(list) && list->nodes[list->activeIndex].nextIndex != PDLL_NONE) {
+        PDLL_Unlink(list, list->nodes[list->activeIndex].nextIndex);
+    }
+}
+
+/**
+ * @brief Deletes the element preceding the active one.
+ *
+ * @param list Pointer to the open list.
+ *
+ * @post Nothing happens if the list is inactive or the active element is the first one.
+ *
+ * @return This function does not return a value.
+ */
+void PDLL_DeleteBefore(PDLList *list) {
+
+    if (PDLL_IsActive(list) && list->nodes[list->activeIndex].previousIndex != PDLL_NONE) {
+        PDLL_Unlink(list, list->nodes[list->activeIndex].previousIndex);
+    }
+}
+
+/**
+ * @brief Inserts a new element after the active one.
+ *
+ * @param list Pointer to the open list.
+ * @param data Value to be inserted.
+ *
+ * @post Nothing happens if the list is inactive.
+ *
+ * @return This function does not return a value.
+ */
+void PDLL_InsertAfter(PDLList *list, int data) {
+
+    if (PDLL_IsActive(list)) {
+        PDLL_Link(list, data, list->activeIndex, list->nodes[list->activeIndex].nextIndex);
+    }
+}
+
+/**
+ * @brief Inserts a new element before the active one.
+ *
+ * @param list Pointer to the open list.
+ * @param data Value to be inserted.
+ *
+ * @post Nothing happens if the list is inactive.
+ *
+ * @return This function does not return a value.
+ */
+void PDLL_InsertBefore(PDLList *list, int data) {
+
+    if (PDLL_IsActive(list)) {
+        PDLL_Link(list, data, list->nodes[list->activeIndex].previousIndex, list->activeIndex);
+    }
+}
+
+/**
+ * @brief Returns the value of the active element.
+ *
+ * @param list Pointer to the open list.
+ * @param dataPtr Pointer to the destination variable.
+ *
+ * @post If the list is inactive, DLL_Error is called and the variable is left untouched.
+ *
+ * @return This function does not return a value.
+ */
+void PDLL_GetValue(PDLList *list, int *dataPtr) {
+
+    if (!PDLL_IsActive(list)) {
+        DLL_Error();
+    } else {
+        *dataPtr = list->nodes[list->activeIndex].data;
+    }
+}
+
+/**
+ * @brief Overwrites the value of the active element.
+ *
+ * @details The value is a single aligned store, so a crash leaves either the old or the
+ *          new value.
+ *
+ * @param list Pointer to the open list.
+ * @param data New value.
+ *
+ * @post Nothing happens if the list is inactive.
+ *
+ * @return This function does not return a value.
+ */
+void PDLL_SetValue(PDLList *list, int data) {
+
+    if (PDLL_IsActive(list)) {
+        list->nodes[list->activeIndex].data = data;
+        PDLL_Persist(list, &list->nodes[list->activeIndex].data, sizeof(int));
+    }
+}
+
+/**
+ * @brief Moves the activity to the next element.
+ *
+ * @param list Pointer to the open list.
+ *
+ * @post The list becomes inactive after its last element.
+ *
+ * @return This function does not return a value.
+ */
+void PDLL_Next(PDLList *list) {
+
+    if (PDLL_IsActive(list)) {
+        list->activeIndex = list->nodes[list->activeIndex].nextIndex;
+    }
+}
+
+/**
+ * @brief Moves the activity to the previous element.
+ *
+ * @param list Pointer to the open list.
+ *
+ * @post The list becomes inactive before its first element.
+ *
+ * @return This function does not return a value.
+ */
+void PDLL_Previous(PDLList *list) {
+
+    if (PDLL_IsActive(list)) {
+        list->activeIndex = list->nodes[list->activeIndex].previousIndex;
+    }
+}
+
+/**
+ * @brief Checks whether the list is active.
+ *
+ * @param list Pointer to the open list.
+ *
+ * @retval int Returns a non-zero value if the list has an active element, otherwise zero.
+ */
+int PDLL_IsActive(PDLList *list) {
+
+    return list->activeIndex != PDLL_NONE;
+}
+
+/* End of c206-persistent.c */
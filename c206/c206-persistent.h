@@ -0,0 +1,157 @@
+/**
+ * @file c206-persistent.h
+ * @brief Doubly linked list living in a memory-mapped file.
+ * @details Declares a list variant whose elements are stored directly in a file mapped
+ *          into memory, so the list survives the process: a restarted program opens the
+ *          file and uses the list at once, without reading or rebuilding anything, and
+ *          the operating system pages the elements in as they are touched, which also
+ *          lets the list grow larger than the memory of the machine.
+ *
+ *          As in c206-compact.h, the elements are slots of one array and their links are
+ *          32-bit slot indices, i.e. offsets relative to the file instead of pointers,
+ *          so the file may be mapped at any address. The operations mirror the DLL_*
+ *          operations of c206.h one to one.
+ *
+ *          The chain of next links from the first element is the only authoritative
+ *          structure. Every insertion writes the new element completely before a single
+ *          aligned 32-bit store links it into that chain, and every deletion unlinks the
+ *          element with a single store before its slot can be reused. The previous
+ *          links, the last element, the length and the free slots are derived data,
+ *          which PDLL_Recover rebuilds from the chain; PDLL_Open does so whenever the
+ *          file was not closed by PDLL_Close. A crash therefore loses at most the
+ *          operation in progress.
+ *
+ * @note Without PDLL_DURABLE, the ordering protects against the process crashing, since
+ *       the written pages stay in the operating system's cache. With PDLL_DURABLE, each
+ *       store that links or unlinks an element is flushed to the disk with msync before
+ *       the operation continues, which also protects against a crash of the machine,
+ *       at the cost of waiting for the disk on every insertion and deletion.
+ *
+ * @note The active element is not stored in the file; a reopened list is inactive. The
+ *       values are stored in the byte order of the machine, like in c206-file.h.
+ *
+ * @see c206-compact.h for the same list in ordinary memory.
+ *
+ * @see https://github.com/Jekwwer/IAL-Project01-2021 for the project repository.
+ */
+
+#ifndef _PDLL_H_
+#define _PDLL_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "c206-ext.h"
+
+/** Index marking the absence of an element. */
+#define PDLL_NONE UINT32_MAX
+/** Flag of PDLL_Open flushing every link update to the disk before going on. */
+#define PDLL_DURABLE 1
+/** Identification at the beginning of every persistent list file. */
+#define PDLL_MAGIC "C206PDL"
+/** Version of the file layout. */
+#define PDLL_VERSION 1
+/** Byte-order mark, reads differently on a machine of the other byte order. */
+#define PDLL_BYTE_ORDER 0x01020304u
+/** Size of the file header, the slots follow it. */
+#define PDLL_HEADER_SIZE 64
+
+/** Element of the persistent list, stored in the file. */
+typedef struct {
+	/** Useful data. */
+	int data;
+	/** Index of the previous element in the list, derived from the next links. */
+	uint32_t previousIndex;
+	/** Index of the next element in the list, or of the next free slot. */
+	uint32_t nextIndex;
+} PDLLNode;
+
+/** Header at the beginning of the file. */
+typedef struct {
+	/** PDLL_MAGIC including the terminating zero. */
+	char magic[8];
+	/** PDLL_BYTE_ORDER as written by the creating machine. */
+	uint32_t byteOrder;
+	/** PDLL_VERSION of the creating program. */
+	uint32_t version;
+	/** Number of slots the file holds. */
+	uint32_t capacity;
+	/** Number of slots that have ever been used; slots above are untouched. */
+	uint32_t used;
+	/** Index of the first element, the start of the authoritative chain. */
+	uint32_t firstIndex;
+	/** Index of the last element, derived. */
+	uint32_t lastIndex;
+	/** Index of the first free slot, derived. */
+	uint32_t freeIndex;
+	/** Number of elements, derived. */
+	uint32_t length;
+	/** Nonzero if the file was closed by PDLL_Close and the derived data is valid. */
+	uint32_t clean;
+} PDLLHeader;
+
+/** Persistent doubly linked list, an open handle of its file. */
+typedef struct {
+	/** Mapped header at the beginning of the file. */
+	PDLLHeader *header;
+	/** Mapped slots following the header. */
+	PDLLNode *nodes;
+	/** Size of the mapping in bytes. */
+	size_t mappedSize;
+	/** Descriptor of the open file. */
+	int fd;
+	/** Nonzero if the list was opened with PDLL_DURABLE. */
+	int durable;
+	/** Size of a memory page, the unit of msync. */
+	size_t pageSize;
+	/** Index of the current element, kept in memory only. */
+	uint32_t activeIndex;
+} PDLList;
+
+int PDLL_Open( PDLList *, const char *, int );
+
+void PDLL_Close( PDLList * );
+
+void PDLL_Recover( PDLList * );
+
+int PDLL_Length( PDLList * );
+
+void PDLL_Dispose( PDLList * );
+
+void PDLL_InsertFirst( PDLList *, int );
+
+void PDLL_InsertLast( PDLList *, int );
+
+void PDLL_First( PDLList * );
+
+void PDLL_Last( PDLList * );
+
+void PDLL_GetFirst( PDLList *, int * );
+
+void PDLL_GetLast( PDLList *, int * );
+
+void PDLL_DeleteFirst( PDLList * );
+
+void PDLL_DeleteLast( PDLList * );
+
+void PDLL_DeleteAfter( PDLList * );
+
+void PDLL_DeleteBefore( PDLList * );
+
+void PDLL_InsertAfter( PDLList *, int );
+
+void PDLL_InsertBefore( PDLList *, int );
+
+void PDLL_GetValue( PDLList *, int * );
+
+void PDLL_SetValue( PDLList *, int );
+
+void PDLL_Next( PDLList * );
+
+void PDLL_Previous( PDLList * );
+
+int PDLL_IsActive( PDLList * );
+
+#endif
+
+/* End of c206-persistent.h */
@@ -0,0 +1,461 @@
+/**
+ * @file c206-rcu.c
+ * @brief Read-mostly list implementation file.
+ * @details Implements the list declared in c206-rcu.h. The writer unlinks a deleted
+ *          element with a single release store into its predecessor and pushes it onto
+ *          the retired list tagged with the current epoch, then advances the epoch. An
+ *          element retired in epoch e is freed once no reader is inside a section it
+ *          entered in epoch e or earlier.
+ *
+ *          A reader entering its section publishes the epoch and then reads the first
+ *          element; the writer unlinks and then scans the reader epochs. A sequentially
+ *          consistent fence on both sides guarantees that the writer sees the reader or
+ *          the reader does not see the element, so no reader reaches a freed element.
+ *
+ *          The functions implemented are:
+ *          - RCUDLL_Init:             Allocates the reader slots.
+ *          - RCUDLL_Dispose:          Frees all elements and the reader slots.
+ *          - RCUDLL_RegisterReader:   Claims a reader slot for the calling thread.
+ *          - RCUDLL_UnregisterReader: Releases a reader slot.
+ *          - RCUDLL_ReadLock:         Enters a read-side section.
+ *          - RCUDLL_ReadUnlock:       Leaves a read-side section.
+ *          - RCUDLL_Find:             Searches for a value.
+ *          - RCUDLL_InsertFirst:      Inserts a value at the beginning.
+ *          - RCUDLL_InsertLast:       Inserts a value at the end.
+ *          - RCUDLL_InsertAfter:      Inserts a value after an element.
+ *          - RCUDLL_Delete:           Unlinks an element and retires it.
+ *          - RCUDLL_DeleteValue:      Deletes the first element holding a value.
+ *          - RCUDLL_Reclaim:          Frees the retired elements no reader can reach.
+ *          - RCUDLL_Synchronize:      Waits until all retired elements are freed.
+ *
+ * @code
+ * // Using example
+ * RCUDLList list;
+ * RCUDLL_Init(&list, 16);
+ * // Reader thread
+ * RCUDLLReader *reader = RCUDLL_RegisterReader(&list);
+ * RCUDLL_ReadLock(reader);
+ * for (RCUDLLElementPtr e = RCUDLL_First(&list); e != NULL; e = RCUDLL_Next(e)) {
+ *     // Read e->data
+ * }
+ * RCUDLL_ReadUnlock(reader);
+ * RCUDLL_UnregisterReader(reader);
+ * // Writer thread
+ * RCUDLL_InsertLast(&list, 42);
+ * RCUDLL_DeleteValue(&list, 42);
+ * // After all threads have finished
+ * RCUDLL_Dispose(&list);
+ * @endcode
+ *
+ * @see c206-rcu.h for type definitions.
+ *
+ * @see https://github.com/Jekwwer/IAL-Project01-2021 for the project repository.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "c206-rcu.h"
+#include <sched.h>
+
+/**
+ * @brief Allocates an unlinked element.
+ *
+ * @param data Value of the element.
+ *
+ * @retval RCUDLLElementPtr The element, or NULL after calling DLL_Error if the memory
+ *                          could not be allocated.
+ */
+static RCUDLLElementPtr RCUDLL_NewElement(int data) {
+
+    RCUDLLElementPtr element = (RCUDLLElementPtr) malloc(sizeof(struct RCUDLLElement));
+    if (element == NULL) {
+        DLL_Error();
+        return NULL;
+    }
+    element->data = data;
+    atomic_init(&element->nextElement, NULL);
+    element->previousElement = NULL;
+    element->nextRetired = NULL;
+    element->retireEpoch = 0;
+    return element;
+}
+
+/**
+ * @brief Links a new element between two neighbours and publishes it to readers.
+ *
+ * @details The element is fully initialized, including its next pointer, before the
+ *          release store that makes it reachable, so a reader finding it also finds
+ *          its value and its successor.
+ *
+ * @param list Pointer to the initialized list, the writer lock is held.
+ * @param previous Element the new one follows, or NULL to insert at the beginning.
+ * @param data Value of the new element.
+ */
+static void RCUDLL_Link(RCUDLList *list, RCUDLLElementPtr previous, int data) {
+
+    RCUDLLElementPtr element = RCUDLL_NewElement(data);
+    if (element == NULL) {
+        return;
+    }
+
+    _Atomic(RCUDLLElementPtr) *link = previous != NULL ? &previous->nextElement : &list->firstElement;
+    RCUDLLElementPtr next = atomic_load_explicit(link, memory_order_relaxed);
+
+    element->previousElement = previous;
+    atomic_store_explicit(&element->nextElement, next, memory_order_relaxed);
+    if (next != NULL) {
+        next->previousElement = element;
+    } else {
+        list->lastElement = element;
+    }
+    atomic_store_explicit(link, element, memory_order_release);
+}
+
+/**
+ * @brief Frees the retired elements that no reader can reach anymore.
+ *
+ * @param list Pointer to the initialized list, the writer lock is held.
+ */
+static void RCUDLL_ReclaimLocked(RCUDLList *list) {
+
+    // Oldest epoch a reader inside its section may have started in
+    uint64_t oldest = atomic_load(&list->epoch);
+    for (int i = 0; i < list->readerCount; i++) {
+        uint64_t epoch = atomic_load(&list->readers[i].epoch);
+        if (epoch != 0 && epoch < oldest) {
+            oldest = epoch;
+        }
+    }
+
+    // The list is ordered from the newest retirement, so the freeable ones form its tail
+    RCUDLLElementPtr *link = &list->retired;
+    while (*link != NULL && (*link)->retireEpoch >= oldest) {
+        link = &(*link)->nextRetired;
+    }
+    RCUDLLElementPtr element = *link;
+    *link = NULL;
+    while (element != NULL) {
+        RCUDLLElementPtr next = element->nextRetired;
+        free(element);
+        list->retiredCount--;
+        element = next;
+    }
+}
+
+/**
+ * @brief Unlinks an element, retires it and frees what can be freed.
+ *
+ * @param list Pointer to the initialized list, the writer lock is held.
+ * @param element Element of the list.
+ */
+static void RCUDLL_Retire(RCUDLList *list, RCUDLLElementPtr element) {
+
+    RCUDLLElementPtr previous = element->previousElement;
+    RCUDLLElementPtr next = atomic_load_explicit(&element->nextElement, memory_order_relaxed);
+    if (previous != NULL) {
+        atomic_store_explicit(&previous->nextElement, next, memory_order_release);
+    } else {
+        atomic_store_explicit(&list->firstElement, next, memory_order_release);
+    }
+    if (next != NULL) {
+        next->previousElement = previous;
+    } else {
+        list->lastElement = previous;
+    }
+
+    element->retireEpoch = atomic_fetch_add(&list->epoch, 1);
+    element->nextRetired = list->retired;
+    list->retired = element;
+    list->retiredCount++;
+
+    // Pairs with the fence in RCUDLL_ReadLock
+    atomic_thread_fence(memory_order_seq_cst);
+    RCUDLL_ReclaimLocked(list);
+}
+
+/**
+ * @brief Initializes the read-mostly list.
+ *
+ * @param list Pointer to the list structure to be initialized.
+ * @param readerCount Maximum number of readers registered at the same time.
+ *
+ * @post The list is empty. If the reader slots cannot be allocated, DLL_Error is called
+ *       and no reader can register.
+ *
+ * @return This function does not return a value.
+ */
+void RCUDLL_Init(RCUDLList *list, int readerCount) {
+
+    atomic_init(&list->firstElement, NULL);
+    list->lastElement = NULL;
+    atomic_init(&list->epoch, 1);
+    pthread_mutex_init(&list->writerLock, NULL);
+    list->retired = NULL;
+    list->retiredCount = 0;
+
+    list->readers = NULL;
+    list->readerCount = 0;
+    if (readerCount > 0) {
+        list->readers = (RCUDLLReader *) aligned_alloc(64, sizeof(RCUDLLReader) * readerCount);
+    }
+    if (list->readers == NULL) {
+        DLL_Error();
+        return;
+    }
+    list->readerCount = readerCount;
+    for (int i = 0; i < readerCount; i++) {
+        atomic_init(&list->readers[i].epoch, 0);
+        atomic_init(&list->readers[i].used, FALSE);
+        list->readers[i].list = list;
+    }
+}
+
+/**
+ * @brief Frees all elements, the retired ones included, and the reader slots.
+ *
+ * @param list Pointer to the initialized list.
+ *
+ * @pre No other thread may use the list anymore.
+ *
+ * @return This function does not return a value.
+ */
+void RCUDLL_Dispose(RCUDLList *list) {
+
+    RCUDLLElementPtr element = atomic_load_explicit(&list->firstElement, memory_order_relaxed);
+    while (element != NULL) {
+        RCUDLLElementPtr next = atomic_load_explicit(&element->nextElement, memory_order_relaxed);
+        free(element);
+        element = next;
+    }
+    while (list->retired != NULL) {
+        element = list->retired;
+        list->retired = element->nextRetired;
+        free(element);
+    }
+
+    free(list->readers);
+    pthread_mutex_destroy(&list->writerLock);
+    atomic_store_explicit(&list->firstElement, NULL, memory_order_relaxed);
+    list->lastElement = NULL;
+    list->readers = NULL;
+    list->readerCount = 0;
+    list->retiredCount = 0;
+}
+
+/**
+ * @brief Claims a reader slot for the calling thread.
+ *
+ * @param list Pointer to the initialized list.
+ *
+ * @retval RCUDLLReader* The slot to pass to RCUDLL_ReadLock and RCUDLL_ReadUnlock, or
+ *                       NULL if all slots are taken.
+ */
+RCUDLLReader *RCUDLL_RegisterReader(RCUDLList *list) {
+
+    for (int i = 0; i < list->readerCount; i++) {
+        int expected = FALSE;
+        if (atomic_compare_exchange_strong(&list->readers[i].used, &expected, TRUE)) {
+            return &list->readers[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Releases a reader slot.
+ *
+ * @param reader Slot returned by RCUDLL_RegisterReader, outside of a read-side section.
+ *
+ * @return This function does not return a value.
+ */
+void RCUDLL_UnregisterReader(RCUDLLReader *reader) {
+
+    atomic_store(&reader->epoch, 0);
+    atomic_store(&reader->used, FALSE);
+}
+
+/**
+ * @brief Enters a read-side section.
+ *
+ * @details Publishes the current epoch so that the writer keeps every element the
+ *          reader may find. Sections must not be nested.
+ *
+ * @param reader Slot of the calling thread.
+ *
+ * @post Elements reached from RCUDLL_First stay valid until RCUDLL_ReadUnlock.
+ *
+ * @return This function does not return a value.
+ */
+void RCUDLL_ReadLock(RCUDLLReader *reader) {
+
+    atomic_store_explicit(&reader->epoch, atomic_load(&reader->list->epoch), memory_order_relaxed);
+    // Pairs with the fence in RCUDLL_Retire
+    atomic_thread_fence(memory_order_seq_cst);
+}
+
+/**
+ * @brief Leaves a read-side section.
+ *
+ * @param reader Slot of the calling thread.
+ *
+ * @post The reader must not use any element found inside the section.
+ *
+ * @return This function does not return a value.
+ */
+void RCUDLL_ReadUnlock(RCUDLLReader *reader) {
+
+    atomic_store_explicit(&reader->epoch, 0, memory_order_release);
+}
+
+/**
+ * @brief Searches for the first element holding a value.
+ *
+ * @param list Pointer to the initialized list.
+ * @param data Value to search for.
+ *
+ * @pre Called by a reader inside its section, or by a writer.
+ *
+ * @retval RCUDLLElementPtr The element, or NULL if the value is not in the list.
+ */
+RCUDLLElementPtr RCUDLL_Find(RCUDLList *list, int data) {
+
+    RCUDLLElementPtr element = RCUDLL_First(list);
+    while (element != NULL && element->data != data) {
+        element = RCUDLL_Next(element);
+    }
+    return element;
+}
+
+/**
+ * @brief Inserts a value at the beginning of the list.
+ *
+ * @param list Pointer to the initialized list.
+ * @param data Value to insert.
+ *
+ * @post If the memory cannot be allocated, DLL_Error is called and the list is unchanged.
+ *
+ * @return This function does not return a value.
+ */
+void RCUDLL_InsertFirst(RCUDLList *list, int data) {
+
+    pthread_mutex_lock(&list->writerLock);
+    RCUDLL_Link(list, NULL, data);
+    pthread_mutex_unlock(&list->writerLock);
+}
+
+/**
+ * @brief Inserts a value at the end of the list.
+ *
+ * @param list Pointer to the initialized list.
+ * @param data Value to insert.
+ *
+ * @post If the memory cannot be allocated, DLL_Error is called and the list is unchanged.
+ *
+ * @return This function does not return a value.
+ */
+void RCUDLL_InsertLast(RCUDLList *list, int data) {
+
+    pthread_mutex_lock(&list->writerLock);
+    RCUDLL_Link(list, list->lastElement, data);
+    pthread_mutex_unlock(&list->writerLock);
+}
+
+/**
+ * @brief Inserts a value after an element.
+ *
+ * @param list Pointer to the initialized list.
+ * @param element Element of the list, found by the calling writer.
+ * @param data Value to insert.
+ *
+ * @pre No other writer deletes 'element' concurrently.
+ *
+ * @post If the memory cannot be allocated, DLL_Error is called and the list is unchanged.
+ *
+ * @return This function does not return a value.
+ */
+void RCUDLL_InsertAfter(RCUDLList *list, RCUDLLElementPtr element, int data) {
+
+    pthread_mutex_lock(&list->writerLock);
+    RCUDLL_Link(list, element, data);
+    pthread_mutex_unlock(&list->writerLock);
+}
+
+/**
+ * @brief Unlinks an element and retires it.
+ *
+ * @details The element keeps its next pointer, so readers standing on it continue past
+ *          it. It is freed by a later reclamation once every reader that might have
+ *          seen it has left its section; this call attempts one right away.
+ *
+ * @param list Pointer to the initialized list.
+ * @param element Element of the list, found by the calling writer.
+ *
+ * @pre No other writer deletes 'element' concurrently.
+ *
+ * @return This function does not return a value.
+ */
+void RCUDLL_Delete(RCUDLList *list, RCUDLLElementPtr element) {
+
+    pthread_mutex_lock(&list->writerLock);
+    RCUDLL_Retire(list, element);
+    pthread_mutex_unlock(&list->writerLock);
+}
+
+/**
+ * @brief Deletes the first element holding a value.
+ *
+ * @param list Pointer to the initialized list.
+ * @param data Value to delete.
+ *
+ * @retval int TRUE if an element was deleted, FALSE if the value is not in the list.
+ */
+int RCUDLL_DeleteValue(RCUDLList *list, int data) {
+
+    pthread_mutex_lock(&list->writerLock);
+    RCUDLLElementPtr element = RCUDLL_Find(list, data);
+    if (element != NULL) {
+        RCUDLL_Retire(list, element);
+    }
+    pthread_mutex_unlock(&list->writerLock);
+    return element != NULL;
+}
+
+/**
+ * @brief Frees the retired elements that no reader can reach anymore.
+ *
+ * @param list Pointer to the initialized list.
+ *
+ * @return This function does not return a value.
+ */
+void RCUDLL_Reclaim(RCUDLList *list) {
+
+    pthread_mutex_lock(&list->writerLock);
+    RCUDLL_ReclaimLocked(list);
+    pthread_mutex_unlock(&list->writerLock);
+}
+
+/**
+ * @brief Waits until all elements deleted so far have been freed.
+ *
+ * @details Yields while readers are still inside sections that began before the last
+ *          deletion. Must not be called from inside a read-side section.
+ *
+ * @param list Pointer to the initialized list.
+ *
+ * @return This function does not return a value.
+ */
+void RCUDLL_Synchronize(RCUDLList *list) {
+
+    for (;;) {
+        pthread_mutex_lock(&list->writerLock);
+        RCUDLL_ReclaimLocked(list);
+        int done = list->retired == NULL;
+        pthread_mutex_unlock(&list->writerLock);
+        if (done) {
+            return;
+        }
+        sched_yield();
+    }
+}
+
+/* End of c206-rcu.c */
@@ -0,0 +1,126 @@
+/**
+ * @file c206-rcu.h
+ * @brief Read-mostly list traversed by readers without locks.
+ * @details Declares a list variant for workloads where many threads look values up and
+ *          a single writer occasionally inserts or deletes. Readers never take a lock and
+ *          never write to shared memory while they walk the list: they only follow next
+ *          pointers, which the writer publishes with release stores. A deleted element
+ *          is unlinked at once but keeps its next pointer, so a reader standing on it
+ *          can still walk on, and the element is freed only after every reader that
+ *          might have seen it has left its read-side section (epoch-based reclamation).
+ *
+ *          Each reader thread registers once and then brackets its traversals with
+ *          RCUDLL_ReadLock and RCUDLL_ReadUnlock, which publish the global epoch the
+ *          reader started in. A deleted element is tagged with the epoch of its removal
+ *          and freed when all readers inside a section started in a later epoch. The
+ *          per-reader epochs lie on separate cache lines, so readers never contend.
+ *
+ *          Writers are serialized by a lock of their own and do not wait for readers;
+ *          RCUDLL_Synchronize waits until everything deleted so far has been freed.
+ *
+ * @note The previous pointers are maintained for the writer only. Readers walk forward
+ *       from RCUDLL_First and must not keep an element after RCUDLL_ReadUnlock.
+ *
+ * @see c206.h for the single-threaded list.
+ *
+ * @see https://github.com/Jekwwer/IAL-Project01-2021 for the project repository.
+ */
+
+#ifndef _RCUDLL_H_
+#define _RCUDLL_H_
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+
+#include "c206-ext.h"
+
+/** Element of the read-mostly list. */
+typedef struct RCUDLLElement {
+	/** Useful data, never changed while the element is in the list. */
+	int data;
+	/** Pointer to the next element, followed by readers. */
+	_Atomic(struct RCUDLLElement *) nextElement;
+	/** Pointer to the previous element, used by the writer only. */
+	struct RCUDLLElement *previousElement;
+	/** Pointer to the next element waiting to be freed. */
+	struct RCUDLLElement *nextRetired;
+	/** Global epoch in which the element was deleted. */
+	uint64_t retireEpoch;
+} *RCUDLLElementPtr;
+
+/** Read-side state of one reader thread, alone on its cache line. */
+typedef struct {
+	/** Epoch the reader entered its section in, or zero outside of a section. */
+	_Alignas(64) _Atomic uint64_t epoch;
+	/** Nonzero while the slot belongs to a registered reader. */
+	_Atomic int used;
+	/** List the reader is registered with. */
+	struct RCUDLList *list;
+} RCUDLLReader;
+
+/** Read-mostly doubly linked list. */
+typedef struct RCUDLList {
+	/** Pointer to the first element, followed by readers. */
+	_Atomic(RCUDLLElementPtr) firstElement;
+	/** Pointer to the last element, used by the writer only. */
+	RCUDLLElementPtr lastElement;
+	/** Current global epoch, starts at one. */
+	_Atomic uint64_t epoch;
+	/** Reader slots. */
+	RCUDLLReader *readers;
+	/** Number of reader slots. */
+	int readerCount;
+	/** Serializes the writers. */
+	pthread_mutex_t writerLock;
+	/** Deleted elements not freed yet, the most recently deleted first. */
+	RCUDLLElementPtr retired;
+	/** Number of elements in 'retired'. */
+	int retiredCount;
+} RCUDLList;
+
+void RCUDLL_Init( RCUDLList *, int );
+
+void RCUDLL_Dispose( RCUDLList * );
+
+RCUDLLReader *RCUDLL_RegisterReader( RCUDLList * );
+
+void RCUDLL_UnregisterReader( RCUDLLReader * );
+
+void RCUDLL_ReadLock( RCUDLLReader * );
+
+void RCUDLL_ReadUnlock( RCUDLLReader * );
+
+RCUDLLElementPtr RCUDLL_Find( RCUDLList *, int );
+
+void RCUDLL_InsertFirst( RCUDLList *, int );
+
+void RCUDLL_InsertLast( RCUDLList *, int );
+
+void RCUDLL_InsertAfter( RCUDLList *, RCUDLLElementPtr, int );
+
+void RCUDLL_Delete( RCUDLList *, RCUDLLElementPtr );
+
+int RCUDLL_DeleteValue( RCUDLList *, int );
+
+void RCUDLL_Reclaim( RCUDLList * );
+
+void RCUDLL_Synchronize( RCUDLList * );
+
+/**
+ * @brief Returns the first element of the list.
+ * @details Defined here so that the traversal inlines into the reader's loop; on common
+ *          hardware the acquire load is an ordinary load.
+ */
+static inline RCUDLLElementPtr RCUDLL_First(RCUDLList *list) {
+    return atomic_load_explicit(&list->firstElement, memory_order_acquire);
+}
+
+/** Returns the element following 'element', or NULL at the end of the list. */
+static inline RCUDLLElementPtr RCUDLL_Next(RCUDLLElementPtr element) {
+    return atomic_load_explicit(&element->nextElement, memory_order_acquire);
+}
+
+#endif
+
+/* End of c206-rcu.h */
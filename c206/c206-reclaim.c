@@ -0,0 +1,244 @@
+/**
+ * @file c206-reclaim.c
+ * @brief Background reclaimer implementation file.
+ * @details Implements the reclaimer declared in c206-reclaim.h. DLL_DisposeAsync cuts
+ *          the chain of elements off the list, lets DLL_Dispose reset the now empty list
+ *          and appends the first element of the chain to a ring buffer. The thread takes
+ *          the oldest chain from the buffer and frees it outside of the lock, so a caller
+ *          only ever waits for the lock, or for a place when the buffer is full.
+ *
+ *          The functions implemented are:
+ *          - DLLReclaimer_Init:    Starts the thread with an empty queue.
+ *          - DLLReclaimer_Dispose: Frees everything still queued and stops the thread.
+ *          - DLLReclaimer_Drain:   Waits until everything queued has been freed.
+ *          - DLLReclaimer_Stats:   Returns a snapshot of the counters.
+ *          - DLL_DisposeAsync:     Empties a list and queues its elements.
+ *
+ * @code
+ * // Using example
+ * DLLReclaimer reclaimer;
+ * DLLReclaimer_Init(&reclaimer, 64);   // At most 64 lists waiting
+ * // ... on the latency-sensitive path
+ * DLL_DisposeAsync(&bigList, &reclaimer);
+ * // ... at shutdown
+ * DLLReclaimer_Dispose(&reclaimer);
+ * @endcode
+ *
+ * @see c206-reclaim.h for type definitions.
+ *
+ * @see https://github.com/Jekwwer/IAL-Project01-2021 for the project repository.
+ */
+
+#include "c206-reclaim.h"
+
+/**
+ * @brief Frees a chain of elements linked through their next pointers.
+ *
+ * @param element First element of the chain.
+ *
+ * @retval unsigned long long Number of elements freed.
+ */
+static unsigned long long DLLReclaimer_FreeChain(DLLElementPtr element) {
+
+    unsigned long long count = 0;
+    while (element != NULL) {
+        DLLElementPtr next = element->nextElement;
+        free(element);
+        element = next;
+        count++;
+    }
+    return count;
+}
+
+/**
+ * @brief Body of the reclaimer thread.
+ *
+ * @details Frees the queued chains in the order they were queued. After
+ *          DLLReclaimer_Dispose has asked it to stop, the thread still empties the
+ *          queue before it finishes.
+ *
+ * @param arg Pointer to the reclaimer.
+ *
+ * @retval void* Always NULL.
+ */
+static void *DLLReclaimer_Run(void *arg) {
+
+    DLLReclaimer *reclaimer = (DLLReclaimer *) arg;
+
+    pthread_mutex_lock(&reclaimer->lock);
+    for (;;) {
+        while (reclaimer->count == 0 && !reclaimer->stopping) {
+            pthread_cond_wait(&reclaimer->queued, &reclaimer->lock);
+        }
+        if (reclaimer->count == 0) {
+            break;
+        }
+
+        DLLElementPtr chain = reclaimer->chains[reclaimer->head];
+        reclaimer->head = (reclaimer->head + 1) % reclaimer->capacity;
+        reclaimer->count--;
+        reclaimer->busy = TRUE;
+        pthread_cond_broadcast(&reclaimer->freed);
+        pthread_mutex_unlock(&reclaimer->lock);
+
+        unsigned long long elements = DLLReclaimer_FreeChain(chain);
+
+        pthread_mutex_lock(&reclaimer->lock);
+        reclaimer->busy = FALSE;
+        reclaimer->stats.listsReclaimed++;
+        reclaimer->stats.elementsReclaimed += elements;
+        pthread_cond_broadcast(&reclaimer->freed);
+    }
+    pthread_mutex_unlock(&reclaimer->lock);
+    return NULL;
+}
+
+/**
+ * @brief Initializes the reclaimer and starts its thread.
+ *
+ * @param reclaimer Pointer to the reclaimer structure to be initialized.
+ * @param capacity Highest number of lists waiting to be freed, at least 1.
+ *
+ * @post The queue is empty and the counters are zero. If the queue cannot be allocated,
+ *       DLL_Error is called. If the queue cannot be allocated or the thread cannot be
+ *       started, the reclaimer stays usable but DLL_DisposeAsync disposes of the lists
+ *       synchronously, like DLL_Dispose.
+ *
+ * @return This function does not return a value.
+ */
+void DLLReclaimer_Init(DLLReclaimer *reclaimer, size_t capacity) {
+
+    if (capacity < 1) {
+        capacity = 1;
+    }
+
+    pthread_mutex_init(&reclaimer->lock, NULL);
+    pthread_cond_init(&reclaimer->queued, NULL);
+    pthread_cond_init(&reclaimer->freed, NULL);
+    reclaimer->capacity = capacity;
+    reclaimer->head = 0;
+    reclaimer->count = 0;
+    reclaimer->busy = FALSE;
+    reclaimer->stopping = FALSE;
+    reclaimer->stats = (DLLReclaimerStats) { 0 };
+    reclaimer->started = FALSE;
+
+    reclaimer->chains = (DLLElementPtr *) malloc(sizeof(DLLElementPtr) * capacity);
+    if (reclaimer->chains == NULL) {
+        DLL_Error();
+        return;
+    }
+    reclaimer->started = pthread_create(&reclaimer->thread, NULL, DLLReclaimer_Run, reclaimer) == 0;
+}
+
+/**
+ * @brief Frees all lists still queued and stops the thread.
+ *
+ * @param reclaimer Pointer to the initialized reclaimer.
+ *
+ * @pre No other thread may call DLL_DisposeAsync with the reclaimer anymore.
+ *
+ * @post Every element ever queued has been freed. The reclaimer must be initialized
+ *       again before further use.
+ *
+ * @return This function does not return a value.
+ */
+void DLLReclaimer_Dispose(DLLReclaimer *reclaimer) {
+
+    pthread_mutex_lock(&reclaimer->lock);
+    reclaimer->stopping = TRUE;
+    pthread_cond_broadcast(&reclaimer->queued);
+    pthread_mutex_unlock(&reclaimer->lock);
+
+    if (reclaimer->started) {
+        pthread_join(reclaimer->thread, NULL);
+        reclaimer->started = FALSE;
+    }
+
+    free(reclaimer->chains);
+    reclaimer->chains = NULL;
+    pthread_cond_destroy(&reclaimer->freed);
+    pthread_cond_destroy(&reclaimer->queued);
+    pthread_mutex_destroy(&reclaimer->lock);
+}
+
+/**
+ * @brief Waits until every list queued so far has been freed.
+ *
+ * @param reclaimer Pointer to the initialized reclaimer.
+ *
+ * @post The queue is empty and the thread is idle, unless other threads keep queueing.
+ *
+ * @return This function does not return a value.
+ */
+void DLLReclaimer_Drain(DLLReclaimer *reclaimer) {
+
+    pthread_mutex_lock(&reclaimer->lock);
+    while (reclaimer->count > 0 || reclaimer->busy) {
+        pthread_cond_wait(&reclaimer->freed, &reclaimer->lock);
+    }
+    pthread_mutex_unlock(&reclaimer->lock);
+}
+
+/**
+ * @brief Returns a consistent snapshot of the counters.
+ *
+ * @param reclaimer Pointer to the initialized reclaimer.
+ * @param stats Pointer to the structure receiving the counters.
+ *
+ * @return This function does not return a value.
+ */
+void DLLReclaimer_Stats(DLLReclaimer *reclaimer, DLLReclaimerStats *stats) {
+
+    pthread_mutex_lock(&reclaimer->lock);
+    *stats = reclaimer->stats;
+    stats->pending = reclaimer->count + (reclaimer->busy ? 1 : 0);
+    pthread_mutex_unlock(&reclaimer->lock);
+}
+
+/**
+ * @brief Empties the list at once and leaves freeing its elements to the reclaimer.
+ *
+ * @details The chain of elements is detached in constant time and queued; the list is
+ *          then reset by DLL_Dispose, which finds it empty. An empty list and a list given
+ *          to a reclaimer without a thread are disposed of directly.
+ *
+ * @param list Pointer to the initialized doubly linked list structure.
+ * @param reclaimer Pointer to the initialized reclaimer.
+ *
+ * @post The list is in the same state as after DLL_Dispose, empty and inactive. If the
+ *       queue is full, the function first waits until the thread takes a list from it.
+ *
+ * @return This function does not return a value.
+ */
+void DLL_DisposeAsync(DLList *list, DLLReclaimer *reclaimer) {
+
+    if (list->firstElement == NULL || !reclaimer->started) {
+        DLL_Dispose(list);
+        return;
+    }
+
+    DLLElementPtr chain = list->firstElement;
+    list->firstElement = NULL;
+    list->activeElement = NULL;
+    list->lastElement = NULL;
+    DLL_Dispose(list);
+
+    pthread_mutex_lock(&reclaimer->lock);
+    if (reclaimer->count == reclaimer->capacity) {
+        reclaimer->stats.fullWaits++;
+        while (reclaimer->count == reclaimer->capacity) {
+            pthread_cond_wait(&reclaimer->freed, &reclaimer->lock);
+        }
+    }
+    reclaimer->chains[(reclaimer->head + reclaimer->count) % reclaimer->capacity] = chain;
+    reclaimer->count++;
+    reclaimer->stats.listsQueued++;
+    if (reclaimer->count > reclaimer->stats.maxQueued) {
+        reclaimer->stats.maxQueued = reclaimer->count;
+    }
+    pthread_cond_signal(&reclaimer->queued);
+    pthread_mutex_unlock(&reclaimer->lock);
+}
+
+/* End of c206-reclaim.c */
@@ -0,0 +1,90 @@
+/**
+ * @file c206-reclaim.h
+ * @brief Background thread freeing the elements of disposed lists.
+ * @details Declares a reclaimer that takes the cost of freeing large lists off the
+ *          calling thread. DLL_Dispose frees the elements of a list one by one, which
+ *          for millions of elements stalls the caller for a long time. DLL_DisposeAsync
+ *          instead detaches the whole chain of elements in constant time, leaves the
+ *          list empty exactly as DLL_Dispose would, and queues the chain to the
+ *          reclaimer, whose thread frees the elements in the background.
+ *
+ *          The queue holds at most a fixed number of chains, so a program disposing
+ *          faster than the thread frees cannot accumulate unbounded garbage: when the
+ *          queue is full, DLL_DisposeAsync waits for a free place. Counters of the
+ *          queued and freed lists and elements, of such waits and of the longest queue
+ *          show whether the capacity suits the workload.
+ *
+ * @note The elements of an XDLList taking them from a pool belong to the pool, which
+ *       XDLL_Dispose already gets them back to in constant time, so the reclaimer works
+ *       on the DLList of c206.h, whose elements are allocated one by one.
+ *
+ * @see c206.h for the list and DLL_Dispose.
+ *
+ * @see https://github.com/Jekwwer/IAL-Project01-2021 for the project repository.
+ */
+
+#ifndef _RECLAIM_H_
+#define _RECLAIM_H_
+
+#include <pthread.h>
+#include <stddef.h>
+
+#include "c206-ext.h"
+
+/** Counters of a reclaimer, a consistent snapshot as returned by DLLReclaimer_Stats. */
+typedef struct {
+	/** Number of lists handed to the reclaimer. */
+	unsigned long long listsQueued;
+	/** Number of lists whose elements have all been freed. */
+	unsigned long long listsReclaimed;
+	/** Number of elements freed by the background thread. */
+	unsigned long long elementsReclaimed;
+	/** Number of times DLL_DisposeAsync had to wait for a place in the queue. */
+	unsigned long long fullWaits;
+	/** Number of lists queued or being freed right now. */
+	size_t pending;
+	/** Highest number of lists ever queued at once. */
+	size_t maxQueued;
+} DLLReclaimerStats;
+
+/** Background reclaimer with a bounded queue of element chains. */
+typedef struct {
+	/** Thread freeing the queued chains. */
+	pthread_t thread;
+	/** Nonzero if the thread is running; otherwise lists are disposed synchronously. */
+	int started;
+	/** Lock protecting all of the following fields. */
+	pthread_mutex_t lock;
+	/** Signalled when a chain is queued or the reclaimer is stopping. */
+	pthread_cond_t queued;
+	/** Signalled when a chain has been taken from the queue or completely freed. */
+	pthread_cond_t freed;
+	/** Ring buffer of the first elements of the queued chains. */
+	DLLElementPtr *chains;
+	/** Number of places in the ring buffer. */
+	size_t capacity;
+	/** Index of the oldest queued chain. */
+	size_t head;
+	/** Number of queued chains. */
+	size_t count;
+	/** Nonzero while the thread is freeing a chain taken from the queue. */
+	int busy;
+	/** Nonzero once DLLReclaimer_Dispose asked the thread to finish. */
+	int stopping;
+	/** Counters, 'pending' is derived when a snapshot is taken. */
+	DLLReclaimerStats stats;
+} DLLReclaimer;
+
+void DLLReclaimer_Init( DLLReclaimer *, size_t );
+
+void DLLReclaimer_Dispose( DLLReclaimer * );
+
+void DLLReclaimer_Drain( DLLReclaimer * );
+
+void DLLReclaimer_Stats( DLLReclaimer *, DLLReclaimerStats * );
+
+void DLL_DisposeAsync( DLList *, DLLReclaimer * );
+
+#endif
+
+/* End of c206-reclaim.h */
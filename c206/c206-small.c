@@ -0,0 +1,519 @@
+/**
+ * @file c206-small.c
+ * @brief Implementation of the list with inline storage for short lists.
+ * @details Implements the SDLL_* operations declared in c206-small.h. Every operation
+ *          first checks whether the list has spilled and, if so, forwards to the DLL_*
+ *          operation on the embedded DLList. Otherwise it works on the inline array:
+ *          insertions go through SDLL_InsertAt and deletions through SDLL_RemoveAt, which
+ *          shift the following values and keep the active index on its value. An
+ *          insertion into a full array first moves the values to heap elements with
+ *          SDLL_Spill.
+ *
+ *          A DLList does not know its length, so the length is counted here in both
+ *          states: a forwarded insertion counts if it linked in a new element, and a
+ *          forwarded deletion if there was an element to delete.
+ *
+ * @code
+ * // Example usage:
+ * SDLList list;
+ * SDLL_Init(&list);
+ * for (int i = 0; i < SDLL_INLINE; i++) {
+ *     SDLL_InsertLast(&list, i);      // No allocation
+ * }
+ * SDLL_InsertLast(&list, SDLL_INLINE); // Moves all values to heap elements
+ * SDLL_Dispose(&list);
+ * @endcode
+ *
+ * @see c206-small.h for definition of constants and types.
+ *
+ * @see https://github.com/Jekwwer/IAL-Project01-2021 for the project repository.
+ */
+
+#include "c206-small.h"
+
+#include <string.h>
+
+/**
+ * @brief Moves the inline values into a list of heap elements.
+ *
+ * @param list Pointer to the initialized list holding SDLL_INLINE values inline.
+ *
+ * @retval int TRUE on success, in which case the same element is active as before.
+ *             FALSE if the memory could not be allocated, in which case DLL_Error has
+ *             been called and the list is unchanged.
+ */
+static int SDLL_Spill(SDLList *list) {
+
+    // The DLList overlays the array, so the values are saved first
+    int values[SDLL_INLINE];
+    int length = list->length;
+    memcpy(values, list->storage.values, sizeof(int) * length);
+
+    DLL_Init(&list->storage.list);
+    for (int i = 0; i < length; i++) {
+        DLLElementPtr last = list->storage.list.lastElement;
+        DLL_InsertLast(&list->storage.list, values[i]);
+        if (list->storage.list.lastElement == last) {
+            DLL_Dispose(&list->storage.list);
+            memcpy(list->storage.values, values, sizeof(int) * length);
+            return FALSE;
+        }
+    }
+    if (list->activeIndex >= 0) {
+        DLL_First(&list->storage.list);
+        for (int i = 0; i < list->activeIndex; i++) {
+            DLL_Next(&list->storage.list);
+        }
+    }
+    list->spilled = TRUE;
+    return TRUE;
+}
+
+/**
+ * @brief Inserts a value into the inline array.
+ *
+ * @param list Pointer to the initialized list holding fewer than SDLL_INLINE values inline.
+ * @param index Position of the new value, from 0 to the length.
+ * @param data Value to insert.
+ *
+ * @post The active index still refers to the value that was active before.
+ */
+static void SDLL_InsertAt(SDLList *list, int index, int data) {
+
+    memmove(&list->storage.values[index + 1], &list->storage.values[index],
+            sizeof(int) * (list->length - index));
+    list->storage.values[index] = data;
+    list->length++;
+    if (list->activeIndex >= index) {
+        list->activeIndex++;
+    }
+}
+
+/**
+ * @brief Removes a value from the inline array.
+ *
+ * @param list Pointer to the initialized list holding its values inline.
+ * @param index Position of the value to remove.
+ *
+ * @post If the removed value was active, the list becomes inactive; otherwise the
+ *       active index still refers to the value that was active before.
+ */
+static void SDLL_RemoveAt(SDLList *list, int index) {
+
+    memmove(&list->storage.values[index], &list->storage.values[index + 1],
+            sizeof(int) * (list->length - index - 1));
+    list->length--;
+    if (list->activeIndex == index) {
+        list->activeIndex = -1;
+    } else if (list->activeIndex > index) {
+        list->activeIndex--;
+    }
+}
+
+/**
+ * @brief Makes room for one more value, spilling a full inline array.
+ *
+ * @param list Pointer to the initialized list.
+ *
+ * @retval int FALSE if the array is full and could not be spilled, TRUE otherwise.
+ */
+static int SDLL_Reserve(SDLList *list) {
+
+    return list->spilled || list->length < SDLL_INLINE || SDLL_Spill(list);
+}
+
+/**
+ * @brief Initializes the list.
+ *
+ * @param list Pointer to the list structure to be initialized.
+ *
+ * @post The list is empty, inactive and stores its values inline.
+ *
+ * @return This function does not return a value.
+ */
+void SDLL_Init(SDLList *list) {
+
+    list->length = 0;
+    list->activeIndex = -1;
+    list->spilled = FALSE;
+}
+
+/**
+ * @brief Deletes all elements of the list and reinitializes it.
+ *
+ * @param list Pointer to the initialized list.
+ *
+ * @post The list is in the same state as after SDLL_Init, storing its values inline.
+ *
+ * @return This function does not return a value.
+ */
+void SDLL_Dispose(SDLList *list) {
+
+    if (list->spilled) {
+        DLL_Dispose(&list->storage.list);
+    }
+    SDLL_Init(list);
+}
+
+/**
+ * @brief Inserts a new element at the beginning of the list.
+ *
+ * @param list Pointer to the initialized list.
+ * @param data Value to be inserted.
+ *
+ * @post If the memory cannot be allocated, DLL_Error is called and the list is unchanged.
+ *
+ * @return This function does not return a value.
+ */
+void SDLL_InsertFirst(SDLList *list, int data) {
+
+    if (!SDLL_Reserve(list)) {
+        return;
+    }
+    if (list->spilled) {
+        DLLElementPtr first = list->storage.list.firstElement;
+        DLL_InsertFirst(&list->storage.list, data);
+        list->length += list->storage.list.firstElement != first;
+    } else {
+        SDLL_InsertAt(list, 0, data);
+    }
+}
+
+/**
+ * @brief Inserts a new element at the end of the list.
+ *
+ * @param list Pointer to the initialized list.
+ * @param data Value to be inserted.
+ *
+ * @post If the memory cannot be allocated, DLL_Error is called and the list is unchanged.
+ *
+ * @return This function does not return a value.
+ */
+void SDLL_InsertLast(SDLList *list, int data) {
+
+    if (!SDLL_Reserve(list)) {
+        return;
+    }
+    if (list->spilled) {
+        DLLElementPtr last = list->storage.list.lastElement;
+        DLL_InsertLast(&list->storage.list, data);
+        list->length += list->storage.list.lastElement != last;
+    } else {
+        list->storage.values[list->length++] = data;
+    }
+}
+
+/**
+ * @brief Sets the first element of the list as active.
+ *
+ * @param list Pointer to the initialized list.
+ *
+ * @return This function does not return a value.
+ */
+void SDLL_First(SDLList *list) {
+
+    if (list->spilled) {
+        DLL_First(&list->storage.list);
+    } else {
+        list->activeIndex = list->length > 0 ? 0 : -1;
+    }
+}
+
+/**
+ * @brief Sets the last element of the list as active.
+ *
+ * @param list Pointer to the initialized list.
+ *
+ * @return This function does not return a value.
+ */
+void SDLL_Last(SDLList *list) {
+
+    if (list->spilled) {
+        DLL_Last(&list->storage.list);
+    } else {
+        list->activeIndex = list->length - 1;
+    }
+}
+
+/**
+ * @brief Returns the value of the first element.
+ *
+ * @param list Pointer to the initialized list.
+ * @param dataPtr Pointer to the variable receiving the value.
+ *
+ * @post If the list is empty, DLL_Error is called and the variable is untouched.
+ *
+ * @return This function does not return a value.
+ */
+void SDLL_GetFirst(SDLList *list, int *dataPtr) {
+
+    if (list->spilled) {
+        DLL_GetFirst(&list->storage.list, dataPtr);
+    } else if (list->length == 0) {
+        DLL_Error();
+    } else {
+        *dataPtr = list->storage.values[0];
+    }
+}
+
+/**
+ * @brief Returns the value of the last element.
+ *
+ * @param list Pointer to the initialized list.
+ * @param dataPtr Pointer to the variable receiving the value.
+ *
+ * @post If the list is empty, DLL_Error is called and the variable is untouched.
+ *
+ * @return This function does not return a value.
+ */
+void SDLL_GetLast(SDLList *list, int *dataPtr) {
+
+    if (list->spilled) {
+        DLL_GetLast(&list->storage.list, dataPtr);
+    } else if (list->length == 0) {
+        DLL_Error();
+    } else {
+        *dataPtr = list->storage.values[list->length - 1];
+    }
+}
+
+/**
+ * @brief Deletes the first element of the list.
+ *
+ * @param list Pointer to the initialized list.
+ *
+ * @post If the element was active, the list becomes inactive. An empty list is unchanged.
+ *
+ * @return This function does not return a value.
+ */
+void SDLL_DeleteFirst(SDLList *list) {
+
+    if (list->spilled) {
+        list->length -= list->storage.list.firstElement != NULL;
+        DLL_DeleteFirst(&list->storage.list);
+    } else if (list->length > 0) {
+        SDLL_RemoveAt(list, 0);
+    }
+}
+
+/**
+ * @brief Deletes the last element of the list.
+ *
+ * @param list Pointer to the initialized list.
+ *
+ * @post If the element was active, the list becomes inactive. An empty list is unchanged.
+ *
+ * @return This function does not return a value.
+ */
+void SDLL_DeleteLast(SDLList *list) {
+
+    if (list->spilled) {
+        list->length -= list->storage.list.lastElement != NULL;
+        DLL_DeleteLast(&list->storage.list);
+    } else if (list->length > 0) {
+        SDLL_RemoveAt(list, list->length - 1);
+    }
+}
+
+/**
+ * @brief Deletes the element following the active one.
+ *
+ * @param list Pointer to the initialized list.
+ *
+ * @post Nothing happens if the list is inactive or the active element is the last one.
+ *
+ * @return This function does not return a value.
+ */
+void SDLL_DeleteAfter(SDLList *list) {
+
+    if (list->spilled) {
+        DLLElementPtr active = list->storage.list.activeElement;
+        list->length -= active != NULL && active->nextElement != NULL;
+        DLL_DeleteAfter(&list->storage.list);
+    } else if (list->activeIndex >= 0 && list->activeIndex + 1 < list->length) {
+        SDLL_RemoveAt(list, list->activeIndex + 1);
+    }
+}
+
+/**
+ * @brief Deletes the element preceding the active one.
+ *
+ * @param list Pointer to the initialized list.
+ *
+ * @post Nothing happens if the list is inactive or the active element is the first one.
+ *
+ * @return This function does not return a value.
+ */
+void SDLL_DeleteBefore(SDLList *list) {
+
+    if (list->spilled) {
+        DLLElementPtr active = list->storage.list.activeElement;
+        list->length -= active != NULL && active->previousElement != NULL;
+        DLL_DeleteBefore(&list->storage.list);
+    } else if (list->activeIndex > 0) {
+        SDLL_RemoveAt(list, list->activeIndex - 1);
+    }
+}
+
+/**
+ * @brief Inserts a new element after the active one.
+ *
+ * @param list Pointer to the initialized list.
+ * @param data Value to be inserted.
+ *
+ * @post Nothing happens if the list is inactive. If the memory cannot be allocated,
+ *       DLL_Error is called and the list is unchanged.
+ *
+ * @return This function does not return a value.
+ */
+void SDLL_InsertAfter(SDLList *list, int data) {
+
+    if (!SDLL_IsActive(list) || !SDLL_Reserve(list)) {
+        return;
+    }
+    if (list->spilled) {
+        DLLElementPtr next = list->storage.list.activeElement->nextElement;
+        DLL_InsertAfter(&list->storage.list, data);
+        list->length += list->storage.list.activeElement->nextElement != next;
+    } else {
+        SDLL_InsertAt(list, list->activeIndex + 1, data);
+    }
+}
+
+/**
+ * @brief Inserts a new element before the active one.
+ *
+ * @param list Pointer to the initialized list.
+ * @param data Value to be inserted.
+ *
+ * @post As for SDLL_InsertAfter.
+ *
+ * @return This function does not return a value.
+ */
+void SDLL_InsertBefore(SDLList *list, int data) {
+
+    if (!SDLL_IsActive(list) || !SDLL_Reserve(list)) {
+        return;
+    }
+    if (list->spilled) {
+        DLLElementPtr previous = list->storage.list.activeElement->previousElement;
+        DLL_InsertBefore(&list->storage.list, data);
+        list->length += list->storage.list.activeElement->previousElement != previous;
+    } else {
+        SDLL_InsertAt(list, list->activeIndex, data);
+    }
+}
+
+/**
+ * @brief Returns the value of the active element.
+ *
+ * @param list Pointer to the initialized list.
+ * @param dataPtr Pointer to the variable receiving the value.
+ *
+ * @post If the list is inactive, DLL_Error is called and the variable is untouched.
+ *
+ * @return This function does not return a value.
+ */
+void SDLL_GetValue(SDLList *list, int *dataPtr) {
+
+    if (list->spilled) {
+        DLL_GetValue(&list->storage.list, dataPtr);
+    } else if (list->activeIndex < 0) {
+        DLL_Error();
+    } else {
+        *dataPtr = list->storage.values[list->activeIndex];
+    }
+}
+
+/**
+ * @brief Overwrites the value of the active element.
+ *
+ * @param list Pointer to the initialized list.
+ * @param data New value.
+ *
+ * @post Nothing happens if the list is inactive.
+ *
+ * @return This function does not return a value.
+ */
+void SDLL_SetValue(SDLList *list, int data) {
+
+    if (list->spilled) {
+        DLL_SetValue(&list->storage.list, data);
+    } else if (list->activeIndex >= 0) {
+        list->storage.values[list->activeIndex] = data;
+    }
+}
+
+/**
+ * @brief Moves the activity to the next element.
+ *
+ * @param list Pointer to the initialized list.
+ *
+ * @post The list becomes inactive if the last element was active.
+ *
+ * @return This function does not return a value.
+ */
+void SDLL_Next(SDLList *list) {
+
+    if (list->spilled) {
+        DLL_Next(&list->storage.list);
+    } else if (list->activeIndex >= 0) {
+        list->activeIndex = list->activeIndex + 1 < list->length ? list->activeIndex + 1 : -1;
+    }
+}
+
+/**
+ * @brief Moves the activity to the previous element.
+ *
+ * @param list Pointer to the initialized list.
+ *
+ * @post The list becomes inactive if the first element was active.
+ *
+ * @return This function does not return a value.
+ */
+void SDLL_Previous(SDLList *list) {
+
+    if (list->spilled) {
+        DLL_Previous(&list->storage.list);
+    } else if (list->activeIndex >= 0) {
+        list->activeIndex--;
+    }
+}
+
+/**
+ * @brief Checks whether the list is active.
+ *
+ * @param list Pointer to the initialized list.
+ *
+ * @retval int Nonzero if an element is active, zero otherwise.
+ */
+int SDLL_IsActive(SDLList *list) {
+
+    return list->spilled ? DLL_IsActive(&list->storage.list) : list->activeIndex >= 0;
+}
+
+/**
+ * @brief Returns the number of elements in the list.
+ *
+ * @param list Pointer to the initialized list.
+ *
+ * @retval int Number of elements.
+ */
+int SDLL_Length(SDLList *list) {
+
+    return list->length;
+}
+
+/**
+ * @brief Checks whether the list has moved its values to heap elements.
+ *
+ * @param list Pointer to the initialized list.
+ *
+ * @retval int Nonzero if the values are in heap elements, zero if they are inline.
+ */
+int SDLL_IsSpilled(SDLList *list) {
+
+    return list->spilled;
+}
+
+/* End of c206-small.c */
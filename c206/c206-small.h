@@ -0,0 +1,105 @@
+/**
+ * @file c206-small.h
+ * @brief Doubly linked list keeping its first elements inline, without allocations.
+ * @details Declares a list variant for programs holding very many short lists. Up to
+ *          SDLL_INLINE values are stored in order in an array inside the list structure
+ *          itself, so a short list performs no allocation at all and takes a single
+ *          structure instead of a DLList plus one DLLElement and its malloc header per
+ *          element. Insertions in the middle of the inline array shift at most
+ *          SDLL_INLINE values, which stays within a cache line or two.
+ *
+ *          The insertion that would exceed SDLL_INLINE values moves them into an ordinary
+ *          DLList of heap elements, occupying the same memory as the array, and from then
+ *          on every operation is forwarded to the corresponding DLL_* operation. A list
+ *          that has grown keeps its heap elements when it shrinks again, so it does not
+ *          move back and forth around the limit; SDLL_Dispose returns it to inline storage.
+ *
+ *          The operations mirror the DLL_* operations of c206.h one to one and behave
+ *          exactly like them in both states.
+ *
+ * @note By default SDLL_INLINE is the number of values filling the space of a DLList, so
+ *       the inline array costs no memory beyond the list it overlays. It may be defined
+ *       smaller before this header is included, and must then be the same in every
+ *       translation unit; a larger value would enlarge every list and is rejected at
+ *       compile time.
+ *
+ * @see c206.h for the list the variant mirrors.
+ *
+ * @see https://github.com/Jekwwer/IAL-Project01-2021 for the project repository.
+ */
+
+#ifndef _SDLL_H_
+#define _SDLL_H_
+
+#include "c206-ext.h"
+
+#ifndef SDLL_INLINE
+/** Number of values stored inline before the list moves to heap elements. */
+#define SDLL_INLINE ((int) (sizeof(DLList) / sizeof(int)))
+#endif
+
+/** Doubly linked list with inline storage for short lists. */
+typedef struct {
+	/** Number of values, inline or in the heap elements. */
+	int length;
+	/** Index of the active value in the inline array, or -1 if inactive. */
+	int activeIndex;
+	/** Nonzero once the values have moved to heap elements in 'storage.list'. */
+	int spilled;
+	/** Storage of the values, the inline array or the list of heap elements. */
+	union {
+		/** Values of a short list, in order. */
+		int values[SDLL_INLINE];
+		/** List holding the values once they no longer fit inline. */
+		DLList list;
+	} storage;
+} SDLList;
+
+_Static_assert(sizeof(((SDLList *) 0)->storage) == sizeof(DLList),
+	"SDLL_INLINE values must fit in the space of a DLList");
+
+void SDLL_Init( SDLList * );
+
+void SDLL_Dispose( SDLList * );
+
+void SDLL_InsertFirst( SDLList *, int );
+
+void SDLL_InsertLast( SDLList *, int );
+
+void SDLL_First( SDLList * );
+
+void SDLL_Last( SDLList * );
+
+void SDLL_GetFirst( SDLList *, int * );
+
+void SDLL_GetLast( SDLList *, int * );
+
+void SDLL_DeleteFirst( SDLList * );
+
+void SDLL_DeleteLast( SDLList * );
+
+void SDLL_DeleteAfter( SDLList * );
+
+void SDLL_DeleteBefore( SDLList * );
+
+void SDLL_InsertAfter( SDLList *, int );
+
+void SDLL_InsertBefore( SDLList *, int );
+
+void SDLL_GetValue( SDLList *, int * );
+
+void SDLL_SetValue( SDLList *, int );
+
+void SDLL_Next( SDLList * );
+
+void SDLL_Previous( SDLList * );
+
+int SDLL_IsActive( SDLList * );
+
+int SDLL_Length( SDLList * );
+
+int SDLL_IsSpilled( SDLList * );
+
+#endif
+
+/* End of c206-small.h */
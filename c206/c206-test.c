@@ -7,9 +7,25 @@
 /*               Daniel Dolejška, September 2021                              */
 /* ************************************************************************** */
 
-#include "c206.h"
+#include "c206-ext.h"
+#include "c206-unrolled.h"
+#include "c206-compact.h"
+#include "c206-concurrent.h"
+#include "c206-rcu.h"
+#include "c206-parallel.h"
+#include "c206-file.h"
+#include "c206-persistent.h"
+#include "c206-lru.h"
+#include "c206-generic.h"
+#include "c206-intrusive.h"
+#include "c206-small.h"
+#include "c206-reclaim.h"
+
+#include <pthread.h>
+#include <string.h>
 
 DLList TEMPLIST;
+XDLList XTEMPLIST;
 int ElemValue = 1;
 /* Handles wrongly linked lists. */
 int MaxListLength = 100;
@@ -354,6 +370,796 @@ int test_DLL_IsActive() {
 	}
 }
 
+/** Counts the unused elements held by a pool. */
+int count_free_elements( DLLPool *pool ) {
+	int count = 0;
+	for (DLLElementPtr element = pool->freeElements; element != NULL; element = element->nextElement)
+		count++;
+	return count;
+}
+
+/** Counts the slabs held by a pool. */
+int count_slabs( DLLPool *pool ) {
+	int count = 0;
+	for (DLLSlab *slab = pool->slabs; slab != NULL; slab = slab->nextSlab)
+		count++;
+	return count;
+}
+
+/** Returns the next number of a fixed pseudo-random sequence below 'bound'. */
+int next_random( int bound ) {
+	static unsigned long state = 20211018;
+	state = state * 6364136223846793005UL + 1442695040888963407UL;
+	return (int) ((state >> 33) % (unsigned long) bound);
+}
+
+/** Copies the values of a list into 'values', returns their count and the active index. */
+int dump_list( DLList *list, int *values, int *activeIndex ) {
+	int count = 0;
+	*activeIndex = -1;
+	for (DLLElementPtr element = list->firstElement; element != NULL; element = element->nextElement)
+	{
+		if (element == list->activeElement)
+			*activeIndex = count;
+		values[count++] = element->data;
+	}
+	return count;
+}
+
+/** Copies the values of an unrolled list into 'values', returns their count and the active index. */
+int dump_unrolled_list( UDLList *list, int *values, int *activeIndex ) {
+	int count = 0;
+	*activeIndex = -1;
+	for (UDLLNodePtr node = list->firstNode; node != NULL; node = node->nextNode)
+		for (int i = 0; i < node->count; i++)
+		{
+			if (node == list->activeNode && i == list->activeIndex)
+				*activeIndex = count;
+			values[count++] = node->data[i];
+		}
+	return count;
+}
+
+/** Maximum number of values the randomized comparisons let a list grow to. */
+#define RANDOM_MAX_LENGTH 2000
+
+/** Length the randomized comparisons currently let a list grow to, at most RANDOM_MAX_LENGTH. */
+int random_max_length = RANDOM_MAX_LENGTH;
+
+/**
+ * Applies the same pseudo-random operation to a DLList and to a variant list and
+ * reports how many times their contents or active positions differed afterwards.
+ * The variant is driven through 'apply' and read through 'dump'.
+ */
+int compare_with_dllist( int operations, void *variant, void (*apply)( void *, int, int ),
+                         int (*dump)( void *, int *, int * ) ) {
+	static int expected[RANDOM_MAX_LENGTH + 1], actual[RANDOM_MAX_LENGTH + 1];
+	DLList reference;
+	DLL_Init(&reference);
+	int mismatches = 0;
+	for (int i = 0; i < operations; i++)
+	{
+		int expectedActive, actualActive;
+		int length = dump_list(&reference, expected, &expectedActive);
+		// Inserting more often than deleting lets the list grow up to the limit
+		int operation = next_random(length < random_max_length ? 15 : 8);
+		int value = next_random(1000);
+		switch (operation)
+		{
+			case 0: DLL_First(&reference); break;
+			case 1: DLL_Last(&reference); break;
+			case 2: DLL_DeleteFirst(&reference); break;
+			case 3: DLL_DeleteLast(&reference); break;
+			case 4: DLL_DeleteAfter(&reference); break;
+			case 5: DLL_DeleteBefore(&reference); break;
+			case 6: DLL_Next(&reference); break;
+			case 7: DLL_Previous(&reference); break;
+			case 8: DLL_SetValue(&reference, value); break;
+			case 9: case 10: DLL_InsertFirst(&reference, value); break;
+			case 11: case 12: DLL_InsertLast(&reference, value); break;
+			case 13: DLL_InsertAfter(&reference, value); break;
+			default: DLL_InsertBefore(&reference, value); break;
+		}
+		apply(variant, operation, value);
+		length = dump_list(&reference, expected, &expectedActive);
+		if (dump(variant, actual, &actualActive) != length || actualActive != expectedActive ||
+		    memcmp(expected, actual, sizeof(int) * length) != 0)
+			mismatches++;
+	}
+	DLL_Dispose(&reference);
+	return mismatches;
+}
+
+/** Applies an operation numbered as in compare_with_dllist to an unrolled list. */
+void apply_to_unrolled_list( void *variant, int operation, int value ) {
+	UDLList *list = variant;
+	switch (operation)
+	{
+		case 0: UDLL_First(list); break;
+		case 1: UDLL_Last(list); break;
+		case 2: UDLL_DeleteFirst(list); break;
+		case 3: UDLL_DeleteLast(list); break;
+		case 4: UDLL_DeleteAfter(list); break;
+		case 5: UDLL_DeleteBefore(list); break;
+		case 6: UDLL_Next(list); break;
+		case 7: UDLL_Previous(list); break;
+		case 8: UDLL_SetValue(list, value); break;
+		case 9: case 10: UDLL_InsertFirst(list, value); break;
+		case 11: case 12: UDLL_InsertLast(list, value); break;
+		case 13: UDLL_InsertAfter(list, value); break;
+		default: UDLL_InsertBefore(list, value); break;
+	}
+}
+
+/** Adapts dump_unrolled_list to compare_with_dllist. */
+int dump_unrolled_variant( void *variant, int *values, int *activeIndex ) {
+	return dump_unrolled_list(variant, values, activeIndex);
+}
+
+/** Applies an operation numbered as in compare_with_dllist to a compact list. */
+void apply_to_compact_list( void *variant, int operation, int value ) {
+	CDLList *list = variant;
+	switch (operation)
+	{
+		case 0: CDLL_First(list); break;
+		case 1: CDLL_Last(list); break;
+		case 2: CDLL_DeleteFirst(list); break;
+		case 3: CDLL_DeleteLast(list); break;
+		case 4: CDLL_DeleteAfter(list); break;
+		case 5: CDLL_DeleteBefore(list); break;
+		case 6: CDLL_Next(list); break;
+		case 7: CDLL_Previous(list); break;
+		case 8: CDLL_SetValue(list, value); break;
+		case 9: case 10: CDLL_InsertFirst(list, value); break;
+		case 11: case 12: CDLL_InsertLast(list, value); break;
+		case 13: CDLL_InsertAfter(list, value); break;
+		default: CDLL_InsertBefore(list, value); break;
+	}
+}
+
+/** Copies the values of a compact list into 'values', returns their count and the active index. */
+int dump_compact_variant( void *variant, int *values, int *activeIndex ) {
+	CDLList *list = variant;
+	int count = 0;
+	*activeIndex = -1;
+	for (uint32_t i = list->firstIndex; i != CDLL_NONE; i = list->nodes[i].nextIndex)
+	{
+		if (i == list->activeIndex)
+			*activeIndex = count;
+		values[count++] = list->nodes[i].data;
+	}
+	return count;
+}
+
+/**
+ * Applies random insertions, deletions and reversals to a list with a seek index and to an
+ * array, seeking a random position after every one, and returns how often they disagreed.
+ */
+int check_seek_index( int operations, int stride ) {
+	static int values[RANDOM_MAX_LENGTH + 1];
+	int length = 0;
+	XDLList list;
+	XDLL_Init(&list);
+	XDLL_SetSeekIndex(&list, stride);
+	int mismatches = 0;
+	for (int i = 0; i < operations; i++)
+	{
+		int operation = next_random(length < RANDOM_MAX_LENGTH ? 10 : 5);
+		int position = next_random(length + 1);
+		if (operation == 0)
+		{
+			XDLL_Reverse(&list);
+			for (int j = 0; j < length / 2; j++)
+			{
+				int value = values[j];
+				values[j] = values[length - 1 - j];
+				values[length - 1 - j] = value;
+			}
+		}
+		else if (operation < 5 && position < length)
+		{
+			XDLL_Seek(&list, position);
+			XDLL_Previous(&list);
+			if (XDLL_IsActive(&list))
+				XDLL_DeleteAfter(&list);
+			else
+				XDLL_DeleteFirst(&list);
+			memmove(&values[position], &values[position + 1], sizeof(int) * (length - position - 1));
+			length--;
+		}
+		else if (operation >= 5)
+		{
+			int value = next_random(1000);
+			XDLL_Seek(&list, position);
+			if (XDLL_IsActive(&list))
+				XDLL_InsertBefore(&list, value);
+			else
+				XDLL_InsertLast(&list, value);
+			memmove(&values[position + 1], &values[position], sizeof(int) * (length - position));
+			values[position] = value;
+			length++;
+		}
+		if (length > 0)
+		{
+			int value = -1;
+			position = next_random(length);
+			XDLL_Seek(&list, position);
+			XDLL_GetValue(&list, &value);
+			if (value != values[position] || XDLL_Position(&list) != position)
+				mismatches++;
+		}
+	}
+	XDLL_Dispose(&list);
+	XDLL_SetSeekIndex(&list, 0);
+	return mismatches;
+}
+
+/** Orders ints for qsort. */
+int compare_values( const void *first, const void *second ) {
+	int a = *(const int *) first, b = *(const int *) second;
+	return (a > b) - (a < b);
+}
+
+/** Points a cursor at the element at 'position' by walking from the first one. */
+void cursor_at( XDLLCursor *cursor, int position ) {
+	XDLL_CursorFirst(cursor);
+	for (int i = 0; i < position; i++)
+		XDLL_CursorNext(cursor);
+}
+
+/**
+ * Applies random cursor edits, moves to the front, splits followed by concatenations, splices
+ * to a second list and back, and occasional sorts to a list with a seek index and to an array,
+ * seeking a random position after every one, and returns how often they disagreed.
+ */
+int check_seek_moves( int operations, int stride ) {
+	static int values[RANDOM_MAX_LENGTH + 1];
+	int length = 0;
+	XDLList list, other;
+	XDLL_Init(&list);
+	XDLL_Init(&other);
+	XDLL_SetSeekIndex(&list, stride);
+	XDLL_SetSeekIndex(&other, stride);
+	XDLLCursor first, last;
+	XDLL_CursorInit(&first, &list);
+	XDLL_CursorInit(&last, &list);
+	int mismatches = 0;
+	for (int i = 0; i < operations; i++)
+	{
+		int operation = next_random(length < RANDOM_MAX_LENGTH ? 8 : 5);
+		int position = next_random(length + 1);
+		if (operation == 0 && position < length)
+		{
+			XDLL_Seek(&list, position);
+			XDLL_MoveToFirst(&list, list.base.activeElement);
+			int value = values[position];
+			memmove(&values[1], &values[0], sizeof(int) * position);
+			values[0] = value;
+		}
+		else if (operation == 1 && position < length)
+		{
+			cursor_at(&first, position);
+			XDLL_CursorDelete(&first);
+			memmove(&values[position], &values[position + 1], sizeof(int) * (length - position - 1));
+			length--;
+		}
+		else if (operation == 2 && position > 0 && position < length)
+		{
+			XDLL_Seek(&list, position - 1);
+			XDLL_Split(&list, &other);
+			mismatches += XDLL_Length(&list) != position || XDLL_Length(&other) != length - position;
+			XDLL_Concat(&list, &other);
+		}
+		else if (operation == 3 && position > 0 && position < length)
+		{
+			int end = position + next_random(length - position);
+			cursor_at(&first, position);
+			cursor_at(&last, end);
+			XDLL_SpliceRange(&other, &first, &last);
+			mismatches += XDLL_Length(&other) != end - position + 1;
+			// XDLL_Concat hands the cursors of 'other' over, so they live only for the way back
+			XDLLCursor otherFirst, otherLast;
+			XDLL_CursorInit(&otherFirst, &other);
+			XDLL_CursorInit(&otherLast, &other);
+			XDLL_CursorFirst(&otherFirst);
+			XDLL_CursorLast(&otherLast);
+			XDLL_Seek(&list, position - 1);
+			XDLL_SpliceRange(&list, &otherFirst, &otherLast);
+			XDLL_CursorDispose(&otherLast);
+			XDLL_CursorDispose(&otherFirst);
+		}
+		else if (operation == 4 && next_random(50) == 0)
+		{
+			XDLL_Sort(&list);
+			qsort(values, length, sizeof(int), compare_values);
+		}
+		else if (operation >= 5)
+		{
+			int value = next_random(1000);
+			if (position < length)
+			{
+				cursor_at(&first, position);
+				XDLL_CursorInsertBefore(&first, value);
+			}
+			else
+				XDLL_InsertLast(&list, value);
+			memmove(&values[position + 1], &values[position], sizeof(int) * (length - position));
+			values[position] = value;
+			length++;
+		}
+		if (XDLL_Length(&list) != length)
+			mismatches++;
+		if (length > 0)
+		{
+			int value = -1;
+			position = next_random(length);
+			XDLL_Seek(&list, position);
+			XDLL_GetValue(&list, &value);
+			if (value != values[position])
+				mismatches++;
+		}
+	}
+	XDLL_CursorDispose(&last);
+	XDLL_CursorDispose(&first);
+	XDLL_Dispose(&other);
+	XDLL_Dispose(&list);
+	XDLL_SetSeekIndex(&other, 0);
+	XDLL_SetSeekIndex(&list, 0);
+	return mismatches;
+}
+
+/** Applies an operation numbered as in compare_with_dllist to an XDLList. */
+void apply_to_extended_list( void *variant, int operation, int value ) {
+	XDLList *list = variant;
+	switch (operation)
+	{
+		case 0: XDLL_First(list); break;
+		case 1: XDLL_Last(list); break;
+		case 2: XDLL_DeleteFirst(list); break;
+		case 3: XDLL_DeleteLast(list); break;
+		case 4: XDLL_DeleteAfter(list); break;
+		case 5: XDLL_DeleteBefore(list); break;
+		case 6: XDLL_Next(list); break;
+		case 7: XDLL_Previous(list); break;
+		case 8: XDLL_SetValue(list, value); break;
+		case 9: case 10: XDLL_InsertFirst(list, value); break;
+		case 11: case 12: XDLL_InsertLast(list, value); break;
+		case 13: XDLL_InsertAfter(list, value); break;
+		default: XDLL_InsertBefore(list, value); break;
+	}
+}
+
+/** Dumps an XDLList, reporting a wrong XDLL_Length or XDLL_Position as a mismatch. */
+int dump_extended_list( void *variant, int *values, int *activeIndex ) {
+	XDLList *list = variant;
+	int count = dump_list(&list->base, values, activeIndex);
+	if (XDLL_Length(list) != count || XDLL_Position(list) != *activeIndex)
+		return -1;
+	return count;
+}
+
+/** Number of producer and of consumer threads using the thread-safe list. */
+#define QUEUE_THREADS 4
+/** Number of values inserted by every producer. */
+#define QUEUE_VALUES 50000
+
+TSDLList QUEUE;
+
+/** Inserts producer * QUEUE_VALUES + i for i = 0 .. QUEUE_VALUES - 1, partly in batches. */
+void *queue_producer( void *arg ) {
+	int producer = (int) (long) arg;
+	int batch[10];
+	for (int i = 0; i < QUEUE_VALUES; i += 10)
+	{
+		for (int j = 0; j < 10; j++)
+			batch[j] = producer * QUEUE_VALUES + i + j;
+		if (i % 20 == 0)
+			TSDLL_InsertLastN(&QUEUE, batch, 10);
+		else
+			for (int j = 0; j < 10; j++)
+				TSDLL_InsertLast(&QUEUE, batch[j]);
+	}
+	return NULL;
+}
+
+/** Result of one consumer thread. */
+typedef struct {
+	long long sum;
+	int count;
+	int outOfOrder;
+} QueueConsumerResult;
+
+/** Removes values until the list is closed, checking that every producer's values come in order. */
+void *queue_consumer( void *arg ) {
+	QueueConsumerResult *result = arg;
+	int lastSeen[QUEUE_THREADS];
+	int values[7];
+	for (int i = 0; i < QUEUE_THREADS; i++)
+		lastSeen[i] = -1;
+	int count;
+	while ((count = result->count % 2 ? TSDLL_PopFirstN(&QUEUE, values, 7) : TSDLL_PopFirst(&QUEUE, values)) > 0)
+	{
+		for (int i = 0; i < count; i++)
+		{
+			int producer = values[i] / QUEUE_VALUES;
+			if (values[i] % QUEUE_VALUES <= lastSeen[producer])
+				result->outOfOrder++;
+			lastSeen[producer] = values[i] % QUEUE_VALUES;
+			result->sum += values[i];
+			result->count++;
+		}
+	}
+	return NULL;
+}
+
+/**
+ * Fills a list with a pseudo-random number of pseudo-random values, sorts it with 'sort'
+ * and returns 0 if the result is ascending, correctly linked both ways and holds the
+ * same values, -1 otherwise.
+ */
+int check_sort( XDLList *list, void (*sort)( XDLList * ) ) {
+	int length = next_random(RANDOM_MAX_LENGTH);
+	long long sum = 0;
+	XDLL_Init(list);
+	for (int i = 0; i < length; i++)
+	{
+		int value = next_random(2000000) - 1000000;
+		if (i % 3 == 0)
+			value = value * 2000 + next_random(2000);
+		XDLL_InsertLast(list, value);
+		sum += value;
+	}
+	sort(list);
+	int count = 0, ok = XDLL_Length(list) == length;
+	for (DLLElementPtr element = list->base.firstElement; element != NULL; element = element->nextElement)
+	{
+		if (element->nextElement != NULL && (element->nextElement->previousElement != element ||
+			element->nextElement->data < element->data))
+			ok = 0;
+		if (element->nextElement == NULL && list->base.lastElement != element)
+			ok = 0;
+		sum -= element->data;
+		count++;
+	}
+	XDLL_Dispose(list);
+	return ok && count == length && sum == 0 ? 0 : -1;
+}
+
+/** Number of reader threads of the read-mostly list. */
+#define RCU_READERS 3
+/** Number of values in the read-mostly list. */
+#define RCU_LENGTH 100
+
+RCUDLList RCULIST;
+atomic_int RcuWriterDone;
+
+/** Deletes values of the read-mostly list and inserts them back at the same place. */
+void *rcu_writer( void *arg ) {
+	(void) arg;
+	for (int i = 0; i < 20000; i++)
+	{
+		int value = 1 + next_random(RCU_LENGTH - 1);
+		RCUDLLElementPtr element = RCUDLL_Find(&RCULIST, value);
+		RCUDLLElementPtr previous = element->previousElement;
+		RCUDLL_Delete(&RCULIST, element);
+		RCUDLL_InsertAfter(&RCULIST, previous, value);
+	}
+	atomic_store(&RcuWriterDone, 1);
+	return NULL;
+}
+
+/**
+ * Scans the read-mostly list until the writer is done, counting scans that are not
+ * ascending or longer than the list. A scan may miss values deleted while it passes.
+ */
+void *rcu_reader( void *arg ) {
+	int *errors = arg;
+	RCUDLLReader *reader = RCUDLL_RegisterReader(&RCULIST);
+	while (!atomic_load(&RcuWriterDone))
+	{
+		int previous = -1, count = 0;
+		RCUDLL_ReadLock(reader);
+		for (RCUDLLElementPtr element = RCUDLL_First(&RCULIST); element != NULL; element = RCUDLL_Next(element))
+		{
+			if (element->data <= previous)
+				(*errors)++;
+			previous = element->data;
+			count++;
+		}
+		RCUDLL_ReadUnlock(reader);
+		if (count > RCU_LENGTH)
+			(*errors)++;
+	}
+	RCUDLL_UnregisterReader(reader);
+	return NULL;
+}
+
+/** Multiplies the value by the factor in 'context', used with DLL_ForEach. */
+void multiply_value( int *value, void *context ) {
+	*value *= *(int *) context;
+}
+
+/** Keeps the values divisible by the divisor in 'context', used with DLL_ParallelFilter. */
+int is_multiple( int value, void *context ) {
+	return value % *(int *) context == 0;
+}
+
+/** Prints the values of a persistent list and checks its previous links. */
+void print_persistent_list( PDLList *list ) {
+	int forward = 0, backward = 0, value;
+	printf("Values:");
+	for (PDLL_First(list); PDLL_IsActive(list); PDLL_Next(list))
+	{
+		PDLL_GetValue(list, &value);
+		printf(" %d", value);
+		forward++;
+	}
+	for (PDLL_Last(list); PDLL_IsActive(list); PDLL_Previous(list))
+		backward++;
+	printf(" (length %d, backward walk %s)\n", PDLL_Length(list),
+		forward == backward && forward == PDLL_Length(list) ? "agrees" : "differs");
+}
+
+/** Number of keys used by the randomized cache test. */
+#define LRU_KEYS 64
+
+/**
+ * Applies random operations to a cache and to a simple model kept in arrays, most
+ * recently used first, and returns the number of operations after which they differ.
+ */
+int compare_lru_with_model( LRUCache *cache, int operations ) {
+	int keys[LRU_KEYS + 1], values[LRU_KEYS + 1], sizes[LRU_KEYS + 1];
+	int count = 0, mismatches = 0;
+	size_t bytes = 0;
+	for (int op = 0; op < operations; op++)
+	{
+		int key = next_random(LRU_KEYS), value = next_random(1000), size = 1 + next_random(20);
+		int kind = next_random(4), found = -1;
+		for (int i = 0; i < count; i++)
+			if (keys[i] == key)
+				found = i;
+		// Every operation but a miss or a removal moves the key to the front
+		if (found >= 0 && kind != 3)
+		{
+			int k = keys[found], v = values[found], sz = sizes[found];
+			memmove(&keys[1], &keys[0], sizeof(int) * found);
+			memmove(&values[1], &values[0], sizeof(int) * found);
+			memmove(&sizes[1], &sizes[0], sizeof(int) * found);
+			keys[0] = k, values[0] = v, sizes[0] = sz;
+		}
+		if (kind <= 1)
+		{
+			int cached = -1;
+			int hit = LRU_Get(cache, key, &cached);
+			if (hit != (found >= 0) || (hit && cached != values[0]))
+				mismatches++;
+		}
+		else if (kind == 2)
+		{
+			LRU_Put(cache, key, value, size);
+			if (found < 0)
+			{
+				memmove(&keys[1], &keys[0], sizeof(int) * count);
+				memmove(&values[1], &values[0], sizeof(int) * count);
+				memmove(&sizes[1], &sizes[0], sizeof(int) * count);
+				count++;
+				sizes[0] = 0;
+			}
+			bytes += size - sizes[0];
+			keys[0] = key, values[0] = value, sizes[0] = size;
+			while (count > 0 && ((cache->maxEntries > 0 && (size_t) count > cache->maxEntries) ||
+			                     (cache->maxBytes > 0 && bytes > cache->maxBytes)))
+				bytes -= sizes[--count];
+		}
+		else
+		{
+			if (LRU_Remove(cache, key) != (found >= 0))
+				mismatches++;
+			if (found >= 0)
+			{
+				bytes -= sizes[found];
+				count--;
+				memmove(&keys[found], &keys[found + 1], sizeof(int) * (count - found));
+				memmove(&values[found], &values[found + 1], sizeof(int) * (count - found));
+				memmove(&sizes[found], &sizes[found + 1], sizeof(int) * (count - found));
+			}
+		}
+		int i = 0;
+		DLLElementPtr element = cache->order.base.firstElement;
+		for (; element != NULL && i < count && element->data == keys[i]; element = element->nextElement)
+			i++;
+		if (element != NULL || i != count || LRU_Count(cache) != (size_t) count || cache->bytes != bytes)
+			mismatches++;
+	}
+	return mismatches;
+}
+
+DLL_DEFINE(IntList, int)
+
+/** Applies an operation numbered as in compare_with_dllist to a generated int list. */
+void apply_to_int_list( void *variant, int operation, int value ) {
+	IntList *list = variant;
+	switch (operation)
+	{
+		case 0: IntList_First(list); break;
+		case 1: IntList_Last(list); break;
+		case 2: IntList_DeleteFirst(list); break;
+		case 3: IntList_DeleteLast(list); break;
+		case 4: IntList_DeleteAfter(list); break;
+		case 5: IntList_DeleteBefore(list); break;
+		case 6: IntList_Next(list); break;
+		case 7: IntList_Previous(list); break;
+		case 8: IntList_SetValue(list, value); break;
+		case 9: case 10: IntList_InsertFirst(list, value); break;
+		case 11: case 12: IntList_InsertLast(list, value); break;
+		case 13: IntList_InsertAfter(list, value); break;
+		default: IntList_InsertBefore(list, value); break;
+	}
+}
+
+/** Dumps a generated int list, reporting a wrong length as a mismatch. */
+int dump_int_list( void *variant, int *values, int *activeIndex ) {
+	IntList *list = variant;
+	int count = 0;
+	*activeIndex = -1;
+	for (IntListElement *element = list->firstElement; element != NULL; element = element->nextElement)
+	{
+		if (element == list->activeElement)
+			*activeIndex = count;
+		values[count++] = element->data;
+	}
+	return count == IntList_Length(list) ? count : -1;
+}
+
+/** Record stored inline in the elements of a generated list. */
+typedef struct {
+	/** Identifier of the record. */
+	int id;
+	/** Arbitrary weight. */
+	double weight;
+	/** Name of the record. */
+	char name[16];
+} Record;
+
+DLL_DEFINE(RecordList, Record)
+
+/** Object that can be in two intrusive lists at once. */
+typedef struct {
+	/** Value of the object. */
+	int value;
+	/** Membership in the compared list, or in the free objects. */
+	IDLLink link;
+	/** Membership in a second list. */
+	IDLLink otherLink;
+} IntItem;
+
+/** Intrusive list compared with DLList, with the objects its operations insert. */
+typedef struct {
+	/** The compared list. */
+	IDLList list;
+	/** Objects that are not in the compared list. */
+	IDLList freeItems;
+	/** All objects, enough for the longest list. */
+	IntItem items[RANDOM_MAX_LENGTH + 1];
+} IntrusiveVariant;
+
+/** Applies an operation numbered as in compare_with_dllist to an intrusive list. */
+void apply_to_intrusive_list( void *variant, int operation, int value ) {
+	IntrusiveVariant *v = variant;
+	IDLList *list = &v->list;
+	IDLLink *victim = NULL;
+	IDLLink *link = NULL;
+	if (operation >= 9)
+	{
+		// Every insertion takes an object that is in no list
+		link = v->freeItems.firstLink;
+		IDLL_DeleteFirst(&v->freeItems);
+		IDLL_ENTRY(link, IntItem, link)->value = value;
+	}
+	switch (operation)
+	{
+		case 0: IDLL_First(list); break;
+		case 1: IDLL_Last(list); break;
+		case 2: victim = list->firstLink; IDLL_DeleteFirst(list); break;
+		case 3: victim = list->lastLink; IDLL_DeleteLast(list); break;
+		case 4: victim = list->activeLink ? list->activeLink->nextLink : NULL; IDLL_DeleteAfter(list); break;
+		case 5: victim = list->activeLink ? list->activeLink->previousLink : NULL; IDLL_DeleteBefore(list); break;
+		case 6: IDLL_Next(list); break;
+		case 7: IDLL_Previous(list); break;
+		case 8:
+			if (IDLL_IsActive(list))
+				IDLL_ENTRY(IDLL_GetValue(list), IntItem, link)->value = value;
+			break;
+		case 9: case 10: IDLL_InsertFirst(list, link); break;
+		case 11: case 12: IDLL_InsertLast(list, link); break;
+		case 13:
+			if (IDLL_IsActive(list))
+				IDLL_InsertAfter(list, link);
+			else
+				victim = link;
+			break;
+		default:
+			if (IDLL_IsActive(list))
+				IDLL_InsertBefore(list, link);
+			else
+				victim = link;
+			break;
+	}
+	if (victim != NULL)
+		IDLL_InsertFirst(&v->freeItems, victim);
+}
+
+/** Dumps an intrusive list, reporting a wrong length as a mismatch. */
+int dump_intrusive_list( void *variant, int *values, int *activeIndex ) {
+	IDLList *list = &((IntrusiveVariant *) variant)->list;
+	int count = 0;
+	*activeIndex = -1;
+	for (IDLLink *link = list->firstLink; link != NULL; link = link->nextLink)
+	{
+		if (link == list->activeLink)
+			*activeIndex = count;
+		values[count++] = IDLL_ENTRY(link, IntItem, link)->value;
+	}
+	return count == IDLL_Length(list) ? count : -1;
+}
+
+/** Applies an operation numbered as in compare_with_dllist to a list with inline storage. */
+void apply_to_small_list( void *variant, int operation, int value ) {
+	SDLList *list = variant;
+	switch (operation)
+	{
+		case 0: SDLL_First(list); break;
+		case 1: SDLL_Last(list); break;
+		case 2: SDLL_DeleteFirst(list); break;
+		case 3: SDLL_DeleteLast(list); break;
+		case 4: SDLL_DeleteAfter(list); break;
+		case 5: SDLL_DeleteBefore(list); break;
+		case 6: SDLL_Next(list); break;
+		case 7: SDLL_Previous(list); break;
+		case 8: SDLL_SetValue(list, value); break;
+		case 9: case 10: SDLL_InsertFirst(list, value); break;
+		case 11: case 12: SDLL_InsertLast(list, value); break;
+		case 13: SDLL_InsertAfter(list, value); break;
+		default: SDLL_InsertBefore(list, value); break;
+	}
+}
+
+/** Dumps a list with inline storage, reporting a wrong length as a mismatch. */
+int dump_small_list( void *variant, int *values, int *activeIndex ) {
+	SDLList *list = variant;
+	int count;
+	if (SDLL_IsSpilled(list))
+		count = dump_list(&list->storage.list, values, activeIndex);
+	else
+	{
+		count = list->length;
+		memcpy(values, list->storage.values, sizeof(int) * count);
+		*activeIndex = list->activeIndex;
+	}
+	return count == SDLL_Length(list) ? count : -1;
+}
+
+/** Prints the values of a list with inline storage through its public operations. */
+void print_small_list( SDLList *list ) {
+	printf("-----------------\n");
+	for (SDLL_First(list); SDLL_IsActive(list); SDLL_Next(list))
+	{
+		int value;
+		SDLL_GetValue(list, &value);
+		printf("%d\n", value);
+	}
+	printf("-----------------\n");
+	printf("Length %d, stored %s.\n", SDLL_Length(list), SDLL_IsSpilled(list) ? "in heap elements" : "inline");
+}
+
+/** Prints the values of the objects in an intrusive list through the given member. */
+void print_intrusive_list( IDLList *list, size_t member ) {
+	printf("-----------------\n");
+	for (IDLLink *link = list->firstLink; link != NULL; link = link->nextLink)
+		printf("%d\n", ((IntItem *) ((char *) link - member))->value);
+	printf("-----------------\n");
+}
+
 /*******************************************************************************
  * BASIC TESTS
  * ---------- 
@@ -484,6 +1290,1107 @@ int main() {
 	test_DLL_Dispose();
 	test_DLL_IsActive();
 
+	printf("\n[TEST19]\n");
+	printf("A pooled list allocates its elements in slabs of 4 and reuses deleted ones.\n");
+	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+	DLLPool pool;
+	DLLPool_Init(&pool, 4);
+	XDLL_InitPooled(&XTEMPLIST, &pool);
+	for (ElemValue = 1; ElemValue <= 5; ElemValue++)
+		XDLL_InsertLast(&XTEMPLIST, ElemValue);
+	print_elements_of_list(XTEMPLIST.base);
+	printf("Free elements in the pool: %d\n", count_free_elements(&pool));
+	XDLL_First(&XTEMPLIST);
+	XDLL_DeleteAfter(&XTEMPLIST);
+	XDLL_InsertBefore(&XTEMPLIST, 6);
+	print_elements_of_list(XTEMPLIST.base);
+	printf("Free elements in the pool: %d\n", count_free_elements(&pool));
+
+	printf("\n[TEST20]\n");
+	printf("Disposing of a pooled list returns all its elements to the pool at once.\n");
+	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+	XDLL_Dispose(&XTEMPLIST);
+	print_elements_of_list(XTEMPLIST.base);
+	printf("Free elements in the pool: %d\n", count_free_elements(&pool));
+	XDLL_InsertFirst(&XTEMPLIST, 7);
+	print_elements_of_list(XTEMPLIST.base);
+	XDLL_Dispose(&XTEMPLIST);
+	DLLPool_Dispose(&pool);
+	printf("Free elements in the pool after DLLPool_Dispose: %d\n", count_free_elements(&pool));
+
+	printf("\n[TEST21]\n");
+	printf("An unrolled list keeps up to %d values per node.\n", (int) UDLL_NODE_CAPACITY);
+	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+	UDLList unrolled;
+	UDLL_Init(&unrolled);
+	for (int i = 1; i <= 60; i++)
+		UDLL_InsertLast(&unrolled, i);
+	UDLL_First(&unrolled);
+	for (int i = 0; i < 10; i++)
+		UDLL_Next(&unrolled);
+	UDLL_InsertAfter(&unrolled, 100);
+	for (int i = 0; i < 20; i++)
+		UDLL_DeleteBefore(&unrolled);
+	for (UDLLNodePtr node = unrolled.firstNode; node != NULL; node = node->nextNode)
+		printf("Node with %d values from %d to %d\n", node->count, node->data[0], node->data[node->count - 1]);
+	int unrolledValue;
+	UDLL_GetValue(&unrolled, &unrolledValue);
+	printf("Operation UDLL_GetValue returns content %d.\n", unrolledValue);
+	UDLL_Dispose(&unrolled);
+
+	printf("\n[TEST22]\n");
+	printf("The unrolled list behaves as DLList during 100000 random operations.\n");
+	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+	UDLL_Init(&unrolled);
+	printf("Mismatches: %d\n", compare_with_dllist(100000, &unrolled, apply_to_unrolled_list, dump_unrolled_variant));
+	UDLL_Dispose(&unrolled);
+
+	printf("\n[TEST23]\n");
+	printf("A compact list stores %d-byte elements in one array and reuses freed slots.\n", (int) sizeof(CDLLNode));
+	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+	CDLList compact;
+	CDLL_Init(&compact);
+	for (int i = 1; i <= 10; i++)
+		CDLL_InsertLast(&compact, i);
+	CDLL_First(&compact);
+	CDLL_DeleteAfter(&compact);
+	CDLL_DeleteAfter(&compact);
+	CDLL_InsertFirst(&compact, 0);
+	printf("Capacity %u, used slots %u, first element in slot %u\n", compact.capacity, compact.used, compact.firstIndex);
+	CDLL_Dispose(&compact);
+
+	printf("\n[TEST24]\n");
+	printf("The compact list behaves as DLList during 100000 random operations.\n");
+	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+	CDLL_Init(&compact);
+	printf("Mismatches: %d\n", compare_with_dllist(100000, &compact, apply_to_compact_list, dump_compact_variant));
+	CDLL_Dispose(&compact);
+
+	printf("\n[TEST25]\n");
+	printf("XDLL_Seek activates elements by position, XDLL_Position and XDLL_Length report them.\n");
+	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+	XDLL_Init(&XTEMPLIST);
+	for (ElemValue = 10; ElemValue <= 60; ElemValue += 10)
+		XDLL_InsertLast(&XTEMPLIST, ElemValue);
+	XDLL_Seek(&XTEMPLIST, 4);
+	print_elements_of_list(XTEMPLIST.base);
+	XDLL_DeleteBefore(&XTEMPLIST);
+	XDLL_InsertFirst(&XTEMPLIST, 5);
+	print_elements_of_list(XTEMPLIST.base);
+	printf("XDLL_Position returns %d, XDLL_Length returns %d.\n", XDLL_Position(&XTEMPLIST), XDLL_Length(&XTEMPLIST));
+	XDLL_Seek(&XTEMPLIST, 1);
+	XDLL_GetValue(&XTEMPLIST, &ElemValue);
+	printf("Operation XDLL_GetValue returns content %d.\n", ElemValue);
+	XDLL_Seek(&XTEMPLIST, 6);
+	printf("Operation XDLL_IsActive returns value %s.\n", XDLL_IsActive(&XTEMPLIST) ? "true" : "false");
+	XDLL_Dispose(&XTEMPLIST);
+
+	printf("\n[TEST26]\n");
+	printf("XDLL_Length and XDLL_Position stay correct during 100000 random operations.\n");
+	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+	XDLList checked;
+	XDLL_Init(&checked);
+	printf("Mismatches: %d\n", compare_with_dllist(100000, &checked, apply_to_extended_list, dump_extended_list));
+	XDLL_Dispose(&checked);
+	for (int stride = 1; stride <= 64; stride *= 8)
+		printf("Seeks through a seek index of stride %d: %d mismatches.\n", stride, check_seek_index(20000, stride));
+
+	printf("\n[TEST27]\n");
+	printf("Two cursors walk the list independently; deleting an element deactivates other cursors on it.\n");
+	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+	XDLL_Init(&XTEMPLIST);
+	for (ElemValue = 1; ElemValue <= 5; ElemValue++)
+		XDLL_InsertLast(&XTEMPLIST, ElemValue);
+	XDLLCursor forward, backward;
+	XDLL_CursorInit(&forward, &XTEMPLIST);
+	XDLL_CursorInit(&backward, &XTEMPLIST);
+	XDLL_CursorFirst(&forward);
+	XDLL_CursorLast(&backward);
+	for (int i = 0; i < 5; i++)
+	{
+		int forwardValue, backwardValue;
+		XDLL_CursorGetValue(&forward, &forwardValue);
+		XDLL_CursorGetValue(&backward, &backwardValue);
+		printf("forward: %d, backward: %d\n", forwardValue, backwardValue);
+		XDLL_CursorNext(&forward);
+		XDLL_CursorPrevious(&backward);
+	}
+	printf("After the walk: forward is %s, backward is %s.\n",
+		XDLL_CursorIsActive(&forward) ? "active" : "inactive",
+		XDLL_CursorIsActive(&backward) ? "active" : "inactive");
+	XDLL_CursorFirst(&forward);
+	XDLL_CursorNext(&forward);
+	XDLL_CursorFirst(&backward);
+	XDLL_CursorNext(&backward);
+	XDLL_First(&XTEMPLIST);
+	XDLL_Next(&XTEMPLIST);
+	XDLL_CursorDelete(&forward);
+	XDLL_CursorGetValue(&forward, &ElemValue);
+	printf("The deleting cursor moved on to %d, the other cursor is %s, the list is %s.\n", ElemValue,
+		XDLL_CursorIsActive(&backward) ? "active" : "inactive",
+		XDLL_IsActive(&XTEMPLIST) ? "active" : "inactive");
+	print_elements_of_list(XTEMPLIST.base);
+	XDLL_CursorLast(&backward);
+	XDLL_DeleteLast(&XTEMPLIST);
+	printf("After XDLL_DeleteLast the cursor on the last element is %s.\n",
+		XDLL_CursorIsActive(&backward) ? "active" : "inactive");
+	XDLL_CursorLast(&backward);
+	XDLL_Dispose(&XTEMPLIST);
+	printf("After XDLL_Dispose the cursors are %s and %s.\n",
+		XDLL_CursorIsActive(&forward) ? "active" : "inactive",
+		XDLL_CursorIsActive(&backward) ? "active" : "inactive");
+	XDLL_CursorDispose(&backward);
+	XDLL_CursorDispose(&forward);
+
+	printf("\n[TEST28]\n");
+	printf("A cursor filters the list and inserts around elements while the list keeps its active element.\n");
+	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+	XDLL_Init(&XTEMPLIST);
+	for (ElemValue = 1; ElemValue <= 8; ElemValue++)
+		XDLL_InsertLast(&XTEMPLIST, ElemValue);
+	XDLL_Seek(&XTEMPLIST, 4);
+	XDLLCursor editor;
+	XDLL_CursorInit(&editor, &XTEMPLIST);
+	XDLL_CursorFirst(&editor);
+	while (XDLL_CursorIsActive(&editor))
+	{
+		XDLL_CursorGetValue(&editor, &ElemValue);
+		if (ElemValue % 2 == 0)
+		{
+			XDLL_CursorDelete(&editor);
+		}
+		else
+		{
+			XDLL_CursorInsertBefore(&editor, -ElemValue);
+			XDLL_CursorInsertAfter(&editor, 10 * ElemValue);
+			XDLL_CursorNext(&editor);
+			XDLL_CursorNext(&editor);
+		}
+	}
+	print_elements_of_list(XTEMPLIST.base);
+	printf("XDLL_Position returns %d, XDLL_Length returns %d.\n", XDLL_Position(&XTEMPLIST), XDLL_Length(&XTEMPLIST));
+	XDLL_CursorDispose(&editor);
+	XDLL_Dispose(&XTEMPLIST);
+
+	printf("\n[TEST29]\n");
+	printf("TSDLL_* operations keep the order of values and report an empty or closed list.\n");
+	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+	TSDLL_Init(&QUEUE);
+	int queueValues[5] = { 2, 3, 4, 5, 6 };
+	TSDLL_InsertLast(&QUEUE, 1);
+	TSDLL_InsertLastN(&QUEUE, queueValues, 5);
+	TSDLL_TryPopFirst(&QUEUE, &ElemValue);
+	printf("TSDLL_TryPopFirst returns %d.\n", ElemValue);
+	int queueCount = TSDLL_TryPopFirstN(&QUEUE, queueValues, 3);
+	printf("TSDLL_TryPopFirstN returns %d values: %d %d %d.\n", queueCount, queueValues[0], queueValues[1], queueValues[2]);
+	queueCount = TSDLL_PopFirstN(&QUEUE, queueValues, 5);
+	printf("TSDLL_PopFirstN returns %d values: %d %d.\n", queueCount, queueValues[0], queueValues[1]);
+	printf("TSDLL_IsEmpty returns %s, TSDLL_TryPopFirst returns %d.\n",
+		TSDLL_IsEmpty(&QUEUE) ? "TRUE" : "FALSE", TSDLL_TryPopFirst(&QUEUE, &ElemValue));
+	TSDLL_InsertLast(&QUEUE, 7);
+	TSDLL_Close(&QUEUE);
+	printf("After TSDLL_Close: TSDLL_PopFirst returns %d", TSDLL_PopFirst(&QUEUE, &ElemValue));
+	printf(" with %d, then %d.\n", ElemValue, TSDLL_PopFirst(&QUEUE, &ElemValue));
+	TSDLL_Dispose(&QUEUE);
+
+	printf("\n[TEST30]\n");
+	printf("4 producers and 4 consumers pass 200000 values through the thread-safe list.\n");
+	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+	TSDLL_Init(&QUEUE);
+	pthread_t producerThreads[QUEUE_THREADS], consumerThreads[QUEUE_THREADS];
+	QueueConsumerResult queueResults[QUEUE_THREADS];
+	memset(queueResults, 0, sizeof(queueResults));
+	for (int i = 0; i < QUEUE_THREADS; i++)
+		pthread_create(&consumerThreads[i], NULL, queue_consumer, &queueResults[i]);
+	for (int i = 0; i < QUEUE_THREADS; i++)
+		pthread_create(&producerThreads[i], NULL, queue_producer, (void *) (long) i);
+	for (int i = 0; i < QUEUE_THREADS; i++)
+		pthread_join(producerThreads[i], NULL);
+	TSDLL_Close(&QUEUE);
+	long long queueSum = 0;
+	int queueTotal = 0, queueOutOfOrder = 0;
+	for (int i = 0; i < QUEUE_THREADS; i++)
+	{
+		pthread_join(consumerThreads[i], NULL);
+		queueSum += queueResults[i].sum;
+		queueTotal += queueResults[i].count;
+		queueOutOfOrder += queueResults[i].outOfOrder;
+	}
+	printf("Values received: %d, sum: %lld, out of order: %d\n", queueTotal, queueSum, queueOutOfOrder);
+	TSDLL_Dispose(&QUEUE);
+
+	printf("\n[TEST31]\n");
+	printf("An element deleted from the read-mostly list is freed only after the reader leaves its section.\n");
+	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+	RCUDLL_Init(&RCULIST, 2);
+	for (ElemValue = 1; ElemValue <= 3; ElemValue++)
+		RCUDLL_InsertLast(&RCULIST, ElemValue);
+	RCUDLLReader *rcuReader = RCUDLL_RegisterReader(&RCULIST);
+	RCUDLL_ReadLock(rcuReader);
+	RCUDLLElementPtr rcuElement = RCUDLL_Find(&RCULIST, 2);
+	RCUDLL_DeleteValue(&RCULIST, 2);
+	printf("Inside the section: retired %d, element %d still leads to %d.\n",
+		RCULIST.retiredCount, rcuElement->data, RCUDLL_Next(rcuElement)->data);
+	RCUDLL_ReadUnlock(rcuReader);
+	RCUDLL_Reclaim(&RCULIST);
+	printf("After the section: retired %d, list:", RCULIST.retiredCount);
+	for (rcuElement = RCUDLL_First(&RCULIST); rcuElement != NULL; rcuElement = RCUDLL_Next(rcuElement))
+		printf(" %d", rcuElement->data);
+	printf("\n");
+	printf("A second reader can register: %s.\n", RCUDLL_RegisterReader(&RCULIST) != NULL ? "yes" : "no");
+	printf("A third reader can register: %s.\n", RCUDLL_RegisterReader(&RCULIST) != NULL ? "yes" : "no");
+	RCUDLL_Dispose(&RCULIST);
+
+	printf("\n[TEST32]\n");
+	printf("3 readers scan the read-mostly list while a writer deletes and reinserts 20000 values.\n");
+	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+	RCUDLL_Init(&RCULIST, RCU_READERS);
+	for (ElemValue = 0; ElemValue < RCU_LENGTH; ElemValue++)
+		RCUDLL_InsertLast(&RCULIST, ElemValue);
+	pthread_t rcuThreads[RCU_READERS + 1];
+	int rcuErrors[RCU_READERS] = { 0 };
+	for (int i = 0; i < RCU_READERS; i++)
+		pthread_create(&rcuThreads[i], NULL, rcu_reader, &rcuErrors[i]);
+	pthread_create(&rcuThreads[RCU_READERS], NULL, rcu_writer, NULL);
+	int rcuErrorTotal = 0;
+	for (int i = 0; i <= RCU_READERS; i++)
+		pthread_join(rcuThreads[i], NULL);
+	for (int i = 0; i < RCU_READERS; i++)
+		rcuErrorTotal += rcuErrors[i];
+	RCUDLL_Synchronize(&RCULIST);
+	printf("Inconsistent scans: %d, retired after synchronizing: %d\n", rcuErrorTotal, RCULIST.retiredCount);
+	RCUDLL_Dispose(&RCULIST);
+
+	printf("\n[TEST33]\n");
+	printf("XDLL_Sort and XDLL_RadixSort order the values and keep equal values in their order.\n");
+	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+	for (int radix = 0; radix <= 1; radix++)
+	{
+		int sortValues[] = { 3, -7, 3, 2147483647, 0, -2147483647 - 1, 12, -7 };
+		XDLL_Init(&XTEMPLIST);
+		for (int i = 0; i < 8; i++)
+			XDLL_InsertLast(&XTEMPLIST, sortValues[i]);
+		DLLElementPtr firstThree = XTEMPLIST.base.firstElement;
+		DLLElementPtr secondThree = firstThree->nextElement->nextElement;
+		XDLL_Last(&XTEMPLIST);
+		if (radix)
+			XDLL_RadixSort(&XTEMPLIST);
+		else
+			XDLL_Sort(&XTEMPLIST);
+		printf("%s:\n", radix ? "XDLL_RadixSort" : "XDLL_Sort");
+		print_elements_of_list(XTEMPLIST.base);
+		printf("Equal values in their order: %s, XDLL_Position returns %d.\n",
+			firstThree->nextElement == secondThree ? "yes" : "no", XDLL_Position(&XTEMPLIST));
+		XDLL_Dispose(&XTEMPLIST);
+	}
+
+	printf("\n[TEST34]\n");
+	printf("XDLL_Sort and XDLL_RadixSort sort 50 pseudo-random lists each.\n");
+	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+	int sortMismatches = 0;
+	for (int i = 0; i < 50; i++)
+		sortMismatches -= check_sort(&XTEMPLIST, XDLL_Sort) + check_sort(&XTEMPLIST, XDLL_RadixSort);
+	printf("Mismatches: %d\n", sortMismatches);
+
+	printf("\n[TEST35]\n");
+	printf("XDLL_Concat joins two lists, XDLL_Split cuts one behind the active element.\n");
+	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+	XDLList spliceList;
+	XDLL_Init(&XTEMPLIST);
+	XDLL_Init(&spliceList);
+	for (ElemValue = 1; ElemValue <= 3; ElemValue++)
+		XDLL_InsertLast(&XTEMPLIST, ElemValue);
+	for (ElemValue = 4; ElemValue <= 6; ElemValue++)
+		XDLL_InsertLast(&spliceList, ElemValue);
+	XDLLCursor spliceCursor;
+	XDLL_CursorInit(&spliceCursor, &spliceList);
+	XDLL_CursorLast(&spliceCursor);
+	XDLL_First(&XTEMPLIST);
+	XDLL_Concat(&XTEMPLIST, &spliceList);
+	print_elements_of_list(XTEMPLIST.base);
+	XDLL_CursorGetValue(&spliceCursor, &ElemValue);
+	printf("Lengths %d and %d, the moved cursor is on %d and belongs to the joined list: %s.\n",
+		XDLL_Length(&XTEMPLIST), XDLL_Length(&spliceList), ElemValue, spliceCursor.list == &XTEMPLIST ? "yes" : "no");
+	XDLL_Seek(&XTEMPLIST, 3);
+	XDLL_Split(&XTEMPLIST, &spliceList);
+	print_elements_of_list(XTEMPLIST.base);
+	print_elements_of_list(spliceList.base);
+	printf("Lengths %d and %d, XDLL_Position returns %d, the cursor is %s.\n", XDLL_Length(&XTEMPLIST),
+		XDLL_Length(&spliceList), XDLL_Position(&XTEMPLIST), XDLL_CursorIsActive(&spliceCursor) ? "active" : "inactive");
+	XDLL_CursorDispose(&spliceCursor);
+
+	printf("\n[TEST36]\n");
+	printf("XDLL_SpliceRange moves a range between cursors behind the active element, XDLL_Reverse reverses.\n");
+	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+	XDLLCursor rangeFirst, rangeLast;
+	XDLL_CursorInit(&rangeFirst, &XTEMPLIST);
+	XDLL_CursorInit(&rangeLast, &XTEMPLIST);
+	XDLL_CursorLast(&rangeFirst);
+	XDLL_CursorFirst(&rangeLast);
+	XDLL_First(&spliceList);
+	printf("A range whose last cursor precedes its first one: ");
+	XDLL_SpliceRange(&spliceList, &rangeFirst, &rangeLast);
+	XDLL_CursorFirst(&rangeFirst);
+	XDLL_CursorNext(&rangeFirst);
+	XDLL_CursorLast(&rangeLast);
+	XDLL_SpliceRange(&spliceList, &rangeFirst, &rangeLast);
+	print_elements_of_list(XTEMPLIST.base);
+	print_elements_of_list(spliceList.base);
+	printf("Lengths %d and %d, XDLL_Position returns %d and %d.\n", XDLL_Length(&XTEMPLIST), XDLL_Length(&spliceList),
+		XDLL_Position(&XTEMPLIST), XDLL_Position(&spliceList));
+	printf("The cursors are %s.\n", XDLL_CursorIsActive(&rangeFirst) || XDLL_CursorIsActive(&rangeLast) ? "active" : "inactive");
+	XDLL_CursorDispose(&rangeLast);
+	XDLL_CursorDispose(&rangeFirst);
+	XDLL_Reverse(&spliceList);
+	print_elements_of_list(spliceList.base);
+	XDLL_Last(&spliceList);
+	XDLL_Previous(&spliceList);
+	XDLL_Previous(&spliceList);
+	XDLL_GetValue(&spliceList, &ElemValue);
+	printf("Walking back from the end reaches %d, XDLL_Position returns %d.\n", ElemValue, XDLL_Position(&spliceList));
+	XDLL_Dispose(&spliceList);
+	XDLL_Dispose(&XTEMPLIST);
+
+	printf("\n[TEST37]\n");
+	printf("XDLL_FromArray fills a pooled list from one slab, XDLL_InsertLastN appends an array.\n");
+	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+	int bulkValues[8] = { 10, 20, 30, 40, 50, 60, 70, 80 };
+	DLLPool_Init(&pool, 4);
+	XDLL_InitPooled(&XTEMPLIST, &pool);
+	XDLL_InsertLast(&XTEMPLIST, 1);
+	XDLL_FromArray(&XTEMPLIST, bulkValues, 6);
+	int contiguous = 1, slabCount = 0;
+	for (DLLElementPtr element = XTEMPLIST.base.firstElement; element->nextElement != NULL; element = element->nextElement)
+		if (element->nextElement != element + 1)
+			contiguous = 0;
+	for (DLLSlab *slab = pool.slabs; slab != NULL; slab = slab->nextSlab)
+		slabCount++;
+	print_elements_of_list(XTEMPLIST.base);
+	printf("Slabs: %d, elements consecutive in memory: %s, free elements: %d (counted %d).\n", slabCount,
+		contiguous ? "yes" : "no", (int) pool.freeCount, count_free_elements(&pool));
+	XDLL_Dispose(&XTEMPLIST);
+	DLLPool_Dispose(&pool);
+	XDLL_Init(&XTEMPLIST);
+	XDLL_InsertLast(&XTEMPLIST, 1);
+	XDLL_First(&XTEMPLIST);
+	XDLL_InsertLastN(&XTEMPLIST, bulkValues, 3);
+	XDLL_InsertLastN(&XTEMPLIST, bulkValues + 6, 2);
+	print_elements_of_list(XTEMPLIST.base);
+	XDLL_Last(&XTEMPLIST);
+	XDLL_Previous(&XTEMPLIST);
+	XDLL_GetValue(&XTEMPLIST, &ElemValue);
+	printf("XDLL_Length returns %d, the element before the last one is %d.\n", XDLL_Length(&XTEMPLIST), ElemValue);
+
+	printf("\n[TEST38]\n");
+	printf("XDLL_ToArray and XDLL_RangeToArray copy values into a buffer.\n");
+	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+	int exported[8];
+	int exportedCount = XDLL_ToArray(&XTEMPLIST, exported, 8);
+	printf("XDLL_ToArray copies %d values:", exportedCount);
+	for (int i = 0; i < exportedCount; i++)
+		printf(" %d", exported[i]);
+	exportedCount = XDLL_ToArray(&XTEMPLIST, exported, 2);
+	printf("\nWith room for 2 values it copies %d: %d %d\n", exportedCount, exported[0], exported[1]);
+	exportedCount = XDLL_RangeToArray(&XTEMPLIST, 2, 3, exported);
+	printf("XDLL_RangeToArray from 2 copies %d values: %d %d %d\n", exportedCount, exported[0], exported[1], exported[2]);
+	exportedCount = XDLL_RangeToArray(&XTEMPLIST, 4, 3, exported);
+	printf("From 4 it copies %d values: %d %d", exportedCount, exported[0], exported[1]);
+	printf(", from 6 it copies %d.\n", XDLL_RangeToArray(&XTEMPLIST, 6, 3, exported));
+	XDLL_Dispose(&XTEMPLIST);
+
+	printf("\n[TEST39]\n");
+	printf("XDLL_Compact lays the elements out in list order and keeps the active element and cursors.\n");
+	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+	for (int pooled = 1; pooled >= 0; pooled--)
+	{
+		DLLPool_Init(&pool, 4);
+		if (pooled)
+			XDLL_InitPooled(&XTEMPLIST, &pool);
+		else
+			XDLL_Init(&XTEMPLIST);
+		for (int i = 0; i < 100; i++)
+		{
+			if (i % 2)
+				XDLL_InsertLast(&XTEMPLIST, i);
+			else
+				XDLL_InsertFirst(&XTEMPLIST, i);
+		}
+		int before[100], after[100];
+		XDLL_ToArray(&XTEMPLIST, before, 100);
+		XDLL_Seek(&XTEMPLIST, 30);
+		XDLLCursor compactCursor;
+		XDLL_CursorInit(&compactCursor, &XTEMPLIST);
+		XDLL_CursorLast(&compactCursor);
+		double fragmentation = XDLL_Fragmentation(&XTEMPLIST);
+		XDLL_Compact(&XTEMPLIST);
+		XDLL_ToArray(&XTEMPLIST, after, 100);
+		int cursorValue = 0;
+		XDLL_GetValue(&XTEMPLIST, &ElemValue);
+		XDLL_CursorGetValue(&compactCursor, &cursorValue);
+		printf("%s list: fragmented before: %s, values unchanged: %s, active %d at %d, cursor on %d",
+			pooled ? "Pooled" : "Malloc", fragmentation > 0.4 ? "yes" : "no",
+			memcmp(before, after, sizeof(before)) == 0 ? "yes" : "no", ElemValue, XDLL_Position(&XTEMPLIST), cursorValue);
+		if (pooled)
+			printf(", fragmentation after: %.2f", XDLL_Fragmentation(&XTEMPLIST));
+		printf(".\n");
+		XDLL_CursorDispose(&compactCursor);
+		XDLL_Dispose(&XTEMPLIST);
+		DLLPool_Dispose(&pool);
+	}
+
+	printf("\n[TEST40]\n");
+	printf("XDLL_MaybeCompact compacts a list that churn has fragmented, XDLL_First never does.\n");
+	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+	DLLPool_Init(&pool, 8);
+	XDLL_InitPooled(&XTEMPLIST, &pool);
+	XDLL_SetAutoCompact(&XTEMPLIST, 0.5);
+	for (int i = 0; i < 64; i++)
+		XDLL_InsertLast(&XTEMPLIST, i);
+	printf("After filling: compacted: %s", XDLL_MaybeCompact(&XTEMPLIST) ? "yes" : "no");
+	printf(", fragmented: %s.\n", XDLL_Fragmentation(&XTEMPLIST) > 0.5 ? "yes" : "no");
+	for (int i = 0; i < 64; i++)
+	{
+		XDLL_Seek(&XTEMPLIST, 1 + next_random(XDLL_Length(&XTEMPLIST) - 1));
+		XDLL_GetValue(&XTEMPLIST, &ElemValue);
+		XDLL_Previous(&XTEMPLIST);
+		XDLL_DeleteAfter(&XTEMPLIST);
+		XDLL_InsertFirst(&XTEMPLIST, ElemValue);
+	}
+	printf("After churn: fragmented: %s, length %d.\n", XDLL_Fragmentation(&XTEMPLIST) > 0.5 ? "yes" : "no", XDLL_Length(&XTEMPLIST));
+	DLLElementPtr firstBefore = XTEMPLIST.base.firstElement;
+	XDLL_First(&XTEMPLIST);
+	printf("After XDLL_First: elements moved: %s.\n", XTEMPLIST.base.firstElement != firstBefore ? "yes" : "no");
+	printf("After XDLL_MaybeCompact: compacted: %s", XDLL_MaybeCompact(&XTEMPLIST) ? "yes" : "no");
+	printf(", fragmentation %.2f, length %d.\n", XDLL_Fragmentation(&XTEMPLIST), XDLL_Length(&XTEMPLIST));
+	XDLL_Dispose(&XTEMPLIST);
+	DLLPool_Dispose(&pool);
+
+	printf("\n[TEST41]\n");
+	printf("XDLL_ForEach changes every value and XDLL_Reduce combines them, on lists short and long.\n");
+	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+	XDLL_Init(&XTEMPLIST);
+	long long emptyMin = XDLL_Reduce(&XTEMPLIST, DLL_REDUCE_MIN);
+	printf("Empty list: sum %lld, min %lld, error reported: %s.\n", XDLL_Reduce(&XTEMPLIST, DLL_REDUCE_SUM),
+		emptyMin, error_flag ? "yes" : "no");
+	error_flag = FALSE;
+	for (int length = 3; length <= 30; length *= 10)
+	{
+		for (int i = 0; i < length; i++)
+			XDLL_InsertLast(&XTEMPLIST, i % 2 ? i : -i);
+		int factor = 3;
+		XDLL_Seek(&XTEMPLIST, 1);
+		XDLL_ForEach(&XTEMPLIST, multiply_value, &factor);
+		XDLL_GetValue(&XTEMPLIST, &ElemValue);
+		printf("Length %d: active %d at %d, ", length, ElemValue, XDLL_Position(&XTEMPLIST));
+		printf("sum %lld, ", XDLL_Reduce(&XTEMPLIST, DLL_REDUCE_SUM));
+		printf("min %lld, ", XDLL_Reduce(&XTEMPLIST, DLL_REDUCE_MIN));
+		printf("max %lld.\n", XDLL_Reduce(&XTEMPLIST, DLL_REDUCE_MAX));
+		XDLL_Dispose(&XTEMPLIST);
+	}
+
+	printf("\n[TEST42]\n");
+	printf("XDLL_Find activates the first occurrence of a value and keeps the position known.\n");
+	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+	XDLL_Init(&XTEMPLIST);
+	for (int i = 0; i < 40; i++)
+		XDLL_InsertLast(&XTEMPLIST, i % 15);
+	XDLL_Seek(&XTEMPLIST, 3);
+	int searched[] = { 0, 7, 14, 15 };
+	for (int i = 0; i < 4; i++)
+	{
+		int found = XDLL_Find(&XTEMPLIST, searched[i]);
+		XDLL_GetValue(&XTEMPLIST, &ElemValue);
+		printf("Find %d: %s, active %d at %d.\n", searched[i], found ? "found" : "not found",
+			ElemValue, XDLL_Position(&XTEMPLIST));
+	}
+	XDLL_Dispose(&XTEMPLIST);
+	printf("Empty list: %s, active: %s.\n", XDLL_Find(&XTEMPLIST, 0) ? "found" : "not found",
+		XDLL_IsActive(&XTEMPLIST) ? "yes" : "no");
+
+	printf("\n[TEST43]\n");
+	printf("XDLL_ParallelForEach and XDLL_ParallelReduce agree with their sequential counterparts.\n");
+	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+	XDLL_Init(&XTEMPLIST);
+	for (int i = 0; i < 1000; i++)
+		XDLL_InsertLast(&XTEMPLIST, next_random(2000) - 1000);
+	for (int count = 1; count <= 16; count *= 4)
+	{
+		DLLSegments segments;
+		DLLSegments_Init(&segments, &XTEMPLIST, count);
+		int factor = -1;
+		XDLL_ParallelForEach(&segments, multiply_value, &factor);
+		int same = 1;
+		for (int reduction = DLL_REDUCE_SUM; reduction <= DLL_REDUCE_MAX; reduction++)
+			same &= XDLL_ParallelReduce(&segments, reduction) == XDLL_Reduce(&XTEMPLIST, reduction);
+		printf("%2d segments: first segment %d elements, last %d, reductions agree: %s.\n", segments.count,
+			segments.lengths[0], segments.lengths[segments.count - 1], same ? "yes" : "no");
+		DLLSegments_Dispose(&segments);
+	}
+	XDLL_Dispose(&XTEMPLIST);
+	{
+		DLLSegments segments;
+		DLLSegments_Init(&segments, &XTEMPLIST, 8);
+		long long emptySum = XDLL_ParallelReduce(&segments, DLL_REDUCE_SUM);
+		printf("Empty list: %d segment, sum %lld.\n", segments.count, emptySum);
+		DLLSegments_Dispose(&segments);
+	}
+
+	printf("\n[TEST44]\n");
+	printf("XDLL_ParallelFilter deletes the non-matching elements and keeps the index valid.\n");
+	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+	for (int pooled = 1; pooled >= 0; pooled--)
+	{
+		DLLPool_Init(&pool, 16);
+		if (pooled)
+			XDLL_InitPooled(&XTEMPLIST, &pool);
+		else
+			XDLL_Init(&XTEMPLIST);
+		for (int i = 1; i <= 100; i++)
+			XDLL_InsertLast(&XTEMPLIST, i);
+		XDLLCursor keptCursor, removedCursor;
+		XDLL_CursorInit(&keptCursor, &XTEMPLIST);
+		XDLL_CursorInit(&removedCursor, &XTEMPLIST);
+		XDLL_CursorLast(&keptCursor);
+		XDLL_CursorFirst(&removedCursor);
+		XDLL_Seek(&XTEMPLIST, 59);
+		DLLSegments segments;
+		DLLSegments_Init(&segments, &XTEMPLIST, 7);
+		int divisor = 4;
+		int removed = XDLL_ParallelFilter(&segments, is_multiple, &divisor);
+		XDLL_GetValue(&XTEMPLIST, &ElemValue);
+		printf("%s list: removed %d, length %d, active %d at %d, cursors active: %s/%s.\n",
+			pooled ? "Pooled" : "Malloc", removed, XDLL_Length(&XTEMPLIST), ElemValue, XDLL_Position(&XTEMPLIST),
+			XDLL_CursorIsActive(&keptCursor) ? "yes" : "no", XDLL_CursorIsActive(&removedCursor) ? "yes" : "no");
+		print_elements_of_list(XTEMPLIST.base);
+		int backward = 0;
+		for (DLLElementPtr element = XTEMPLIST.base.lastElement; element != NULL; element = element->previousElement)
+			backward += element->nextElement == NULL || element->nextElement->previousElement == element;
+		printf("Backward links consistent: %s.\n", backward == XDLL_Length(&XTEMPLIST) ? "yes" : "no");
+		divisor = 12;
+		removed = XDLL_ParallelFilter(&segments, is_multiple, &divisor);
+		printf("Filtered again over the same index: removed %d, active: %s, sum %lld, max %lld.\n", removed,
+			XDLL_IsActive(&XTEMPLIST) ? "yes" : "no", XDLL_ParallelReduce(&segments, DLL_REDUCE_SUM),
+			XDLL_Reduce(&XTEMPLIST, DLL_REDUCE_MAX));
+		print_elements_of_list(XTEMPLIST.base);
+		divisor = 1000;
+		removed = XDLL_ParallelFilter(&segments, is_multiple, &divisor);
+		printf("Filtered to nothing: removed %d, length %d.\n", removed, XDLL_Length(&XTEMPLIST));
+		print_elements_of_list(XTEMPLIST.base);
+		DLLSegments_Dispose(&segments);
+		XDLL_CursorDispose(&removedCursor);
+		XDLL_CursorDispose(&keptCursor);
+		XDLL_Dispose(&XTEMPLIST);
+		DLLPool_Dispose(&pool);
+	}
+
+	printf("\n[TEST45]\n");
+	printf("XDLL_Save and XDLL_Load restore the values and the active element, pooled or not.\n");
+	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+	XDLL_Init(&XTEMPLIST);
+	for (int i = 0; i < 5000; i++)
+		XDLL_InsertLast(&XTEMPLIST, next_random(2000) - 1000);
+	XDLL_Seek(&XTEMPLIST, 4321);
+	int saved = XDLL_Save(&XTEMPLIST, "c206-test.tmp.dll");
+	int *savedValues = malloc(sizeof(int) * 5000);
+	int *loadedValues = malloc(sizeof(int) * 5000);
+	XDLL_ToArray(&XTEMPLIST, savedValues, 5000);
+	XDLL_Dispose(&XTEMPLIST);
+	for (int pooled = 1; pooled >= 0; pooled--)
+	{
+		DLLPool_Init(&pool, 16);
+		if (pooled)
+			XDLL_InitPooled(&XTEMPLIST, &pool);
+		else
+			XDLL_Init(&XTEMPLIST);
+		XDLL_InsertLast(&XTEMPLIST, 42);
+		int loaded = XDLL_Load(&XTEMPLIST, "c206-test.tmp.dll");
+		XDLL_ToArray(&XTEMPLIST, loadedValues, 5000);
+		printf("%s list: saved: %s, loaded: %s, length %d, values equal: %s, active at %d.\n",
+			pooled ? "Pooled" : "Malloc", saved ? "yes" : "no", loaded ? "yes" : "no", XDLL_Length(&XTEMPLIST),
+			memcmp(savedValues, loadedValues, sizeof(int) * 5000) == 0 ? "yes" : "no", XDLL_Position(&XTEMPLIST));
+		if (pooled)
+			printf("All elements allocated as one slab: %s.\n", pool.slabs->elementCount == 5000 ? "yes" : "no");
+		XDLL_Dispose(&XTEMPLIST);
+		DLLPool_Dispose(&pool);
+	}
+	free(loadedValues);
+	free(savedValues);
+	XDLL_Init(&XTEMPLIST);
+	saved = XDLL_Save(&XTEMPLIST, "c206-test.tmp.dll");
+	XDLL_InsertLast(&XTEMPLIST, 42);
+	XDLL_First(&XTEMPLIST);
+	int loaded = XDLL_Load(&XTEMPLIST, "c206-test.tmp.dll");
+	printf("Empty list: saved: %s, loaded: %s, length %d, active: %s.\n", saved ? "yes" : "no",
+		loaded ? "yes" : "no", XDLL_Length(&XTEMPLIST), XDLL_IsActive(&XTEMPLIST) ? "yes" : "no");
+	XDLL_Dispose(&XTEMPLIST);
+	saved = XDLL_Save(&XTEMPLIST, "c206-test.missing/c206-test.tmp.dll");
+	printf("Saving into a missing directory: saved: %s.\n", saved ? "yes" : "no");
+
+	printf("\n[TEST46]\n");
+	printf("XDLL_Load rejects missing, damaged and foreign files and leaves the list unchanged.\n");
+	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+	XDLL_Init(&XTEMPLIST);
+	XDLL_InsertLast(&XTEMPLIST, 7);
+	XDLL_First(&XTEMPLIST);
+	{
+		static const char *names[] = { "Missing file", "Truncated file", "Wrong byte order", "Wrong magic",
+		                               "Active position out of range" };
+		int32_t fileValues[10] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+		for (int damage = 0; damage < 5; damage++)
+		{
+			DLLFileHeader header = { DLLFILE_MAGIC, DLLFILE_BYTE_ORDER, DLLFILE_VERSION, 10, 3 };
+			if (damage == 2)
+				header.byteOrder = 0x04030201u;
+			if (damage == 3)
+				memcpy(header.magic, "TEXT", 5);
+			if (damage == 4)
+				header.activePosition = 10;
+			FILE *file = fopen("c206-test.tmp.dll", "wb");
+			fwrite(&header, sizeof(header), 1, file);
+			fwrite(fileValues, sizeof(int32_t), damage == 1 ? 9 : 10, file);
+			fclose(file);
+			int loaded = XDLL_Load(&XTEMPLIST, damage == 0 ? "c206-test.missing.dll" : "c206-test.tmp.dll");
+			XDLL_GetValue(&XTEMPLIST, &ElemValue);
+			printf("%s: loaded: %s, length %d, active %d.\n", names[damage], loaded ? "yes" : "no",
+				XDLL_Length(&XTEMPLIST), ElemValue);
+		}
+		DLLFileHeader header = { DLLFILE_MAGIC, DLLFILE_BYTE_ORDER, DLLFILE_VERSION, 10, 3 };
+		FILE *file = fopen("c206-test.tmp.dll", "wb");
+		fwrite(&header, sizeof(header), 1, file);
+		fwrite(fileValues, sizeof(int32_t), 10, file);
+		fclose(file);
+		int loaded = XDLL_Load(&XTEMPLIST, "c206-test.tmp.dll");
+		XDLL_GetValue(&XTEMPLIST, &ElemValue);
+		printf("Intact file: loaded: %s, length %d, active %d.\n", loaded ? "yes" : "no",
+			XDLL_Length(&XTEMPLIST), ElemValue);
+	}
+	remove("c206-test.tmp.dll");
+	XDLL_Dispose(&XTEMPLIST);
+
+	printf("\n[TEST47]\n");
+	printf("A persistent list keeps its elements across PDLL_Close and PDLL_Open.\n");
+	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+	{
+		PDLList persistent;
+		remove("c206-test.tmp.pdl");
+		int opened = PDLL_Open(&persistent, "c206-test.tmp.pdl", 0);
+		for (int i = 1; i <= 5; i++)
+			PDLL_InsertLast(&persistent, i);
+		PDLL_InsertFirst(&persistent, 0);
+		PDLL_First(&persistent);
+		PDLL_Next(&persistent);
+		PDLL_InsertAfter(&persistent, 15);
+		PDLL_DeleteBefore(&persistent);
+		PDLL_Last(&persistent);
+		PDLL_SetValue(&persistent, 50);
+		PDLL_DeleteBefore(&persistent);
+		printf("Created: %s. ", opened ? "yes" : "no");
+		print_persistent_list(&persistent);
+		PDLL_Close(&persistent);
+
+		opened = PDLL_Open(&persistent, "c206-test.tmp.pdl", PDLL_DURABLE);
+		printf("Reopened: %s, active: %s. ", opened ? "yes" : "no", PDLL_IsActive(&persistent) ? "yes" : "no");
+		print_persistent_list(&persistent);
+		PDLL_DeleteFirst(&persistent);
+		PDLL_DeleteLast(&persistent);
+		PDLL_First(&persistent);
+		PDLL_InsertBefore(&persistent, -1);
+		PDLL_Close(&persistent);
+
+		PDLL_Open(&persistent, "c206-test.tmp.pdl", 0);
+		printf("Durable changes kept. ");
+		print_persistent_list(&persistent);
+		for (int i = 0; i < 3000; i++)
+			PDLL_InsertLast(&persistent, i);
+		PDLL_Close(&persistent);
+		PDLL_Open(&persistent, "c206-test.tmp.pdl", 0);
+		int first = 0, last = 0;
+		PDLL_GetFirst(&persistent, &first);
+		PDLL_GetLast(&persistent, &last);
+		printf("After growing: length %d, first %d, last %d, capacity %u.\n", PDLL_Length(&persistent),
+			first, last, persistent.header->capacity);
+		PDLL_Dispose(&persistent);
+		PDLL_Close(&persistent);
+		PDLL_Open(&persistent, "c206-test.tmp.pdl", 0);
+		printf("After PDLL_Dispose: length %d.\n", PDLL_Length(&persistent));
+		PDLL_Close(&persistent);
+	}
+
+	printf("\n[TEST48]\n");
+	printf("PDLL_Open recovers a file left by a crash in the middle of an insertion and a deletion.\n");
+	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+	{
+		PDLList crashed, recovered;
+		remove("c206-test.tmp.pdl");
+		PDLL_Open(&crashed, "c206-test.tmp.pdl", 0);
+		for (int i = 0; i < 10; i++)
+			PDLL_InsertLast(&crashed, i);
+		// An insertion that wrote its slot but did not link it
+		uint32_t lost = crashed.header->used++;
+		crashed.nodes[lost].data = 100;
+		crashed.nodes[lost].nextIndex = 4;
+		// A deletion of 3 that linked 2 to 4 but did not get any further
+		crashed.nodes[2].nextIndex = 4;
+		// Derived data of other operations in progress
+		crashed.header->length = 99;
+		crashed.nodes[7].previousIndex = 1;
+		// The crashed process never closes the file, a new one opens it
+		int opened = PDLL_Open(&recovered, "c206-test.tmp.pdl", 0);
+		printf("Opened after the crash: %s. ", opened ? "yes" : "no");
+		print_persistent_list(&recovered);
+		uint32_t used = recovered.header->used;
+		PDLL_InsertLast(&recovered, 10);
+		PDLL_InsertLast(&recovered, 11);
+		printf("Lost slots reused: %s. ", recovered.header->used == used ? "yes" : "no");
+		print_persistent_list(&recovered);
+		PDLL_Close(&recovered);
+		PDLL_Close(&crashed);
+	}
+	{
+		PDLList crashed, recovered;
+		remove("c206-test.tmp.pdl");
+		PDLL_Open(&crashed, "c206-test.tmp.pdl", PDLL_DURABLE);
+		uint32_t initialCapacity = crashed.header->capacity;
+		for (int i = 0; i < 1500; i++)
+			PDLL_InsertLast(&crashed, i);
+		// The file was extended, but the disk still holds the capacity before the grow
+		crashed.header->capacity = initialCapacity;
+		int opened = PDLL_Open(&recovered, "c206-test.tmp.pdl", 0);
+		int last = 0;
+		PDLL_GetLast(&recovered, &last);
+		printf("Opened after losing the grown capacity: %s, length %d, last %d, capacity restored: %s.\n",
+			opened ? "yes" : "no", PDLL_Length(&recovered), last,
+			recovered.header->capacity > initialCapacity ? "yes" : "no");
+		PDLL_Close(&recovered);
+		PDLL_Close(&crashed);
+
+		// A crash during the creation left the file extended with its header still zero
+		static const char zeroes[PDLL_HEADER_SIZE + 100];
+		FILE *file = fopen("c206-test.tmp.pdl", "wb");
+		fwrite(zeroes, 1, sizeof(zeroes), file);
+		fclose(file);
+		opened = PDLL_Open(&recovered, "c206-test.tmp.pdl", 0);
+		PDLL_InsertLast(&recovered, 1);
+		printf("Opened a file with a zero header: %s, length %d.\n", opened ? "yes" : "no",
+			PDLL_Length(&recovered));
+		PDLL_Close(&recovered);
+	}
+	{
+		PDLList persistent;
+		XDLL_Init(&XTEMPLIST);
+		XDLL_InsertLast(&XTEMPLIST, 1);
+		XDLL_Save(&XTEMPLIST, "c206-test.tmp.pdl");
+		XDLL_Dispose(&XTEMPLIST);
+		printf("Opening an XDLL_Save file: %s.\n", PDLL_Open(&persistent, "c206-test.tmp.pdl", 0) ? "opened" : "rejected");
+		remove("c206-test.tmp.pdl");
+	}
+
+	printf("\n[TEST49]\n");
+	printf("XDLL_MoveToFirst and XDLL_DeleteElement relink elements given by pointer.\n");
+	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+	XDLL_Init(&XTEMPLIST);
+	for (int i = 1; i <= 5; i++)
+		XDLL_InsertLast(&XTEMPLIST, i);
+	XDLL_Seek(&XTEMPLIST, 2);
+	XDLL_MoveToFirst(&XTEMPLIST, XTEMPLIST.base.lastElement);
+	XDLL_MoveToFirst(&XTEMPLIST, XTEMPLIST.base.firstElement->nextElement->nextElement);
+	XDLL_DeleteElement(&XTEMPLIST, XTEMPLIST.base.firstElement->nextElement);
+	print_elements_of_list(XTEMPLIST.base);
+	XDLL_GetValue(&XTEMPLIST, &ElemValue);
+	printf("Length %d, active %d at %d.\n", XDLL_Length(&XTEMPLIST), ElemValue, XDLL_Position(&XTEMPLIST));
+	XDLL_DeleteElement(&XTEMPLIST, XTEMPLIST.base.activeElement);
+	XDLL_GetLast(&XTEMPLIST, &ElemValue);
+	printf("After deleting the active element: active: %s, length %d, last %d.\n",
+		XDLL_IsActive(&XTEMPLIST) ? "yes" : "no", XDLL_Length(&XTEMPLIST), ElemValue);
+	XDLL_Dispose(&XTEMPLIST);
+
+	printf("\n[TEST50]\n");
+	printf("The LRU cache evicts the least recently used entries and agrees with a simple model.\n");
+	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+	{
+		LRUCache cache;
+		LRU_Init(&cache, 3, 0);
+		for (int key = 1; key <= 3; key++)
+			LRU_Put(&cache, key, key * 10, 0);
+		int value = 0;
+		int hit = LRU_Get(&cache, 1, &value);
+		LRU_Put(&cache, 4, 40, 0);
+		int evicted = !LRU_Get(&cache, 2, &value);
+		printf("Get 1: %s %d, key 2 evicted by key 4: %s, count %zu.\n", hit ? "hit" : "miss", value,
+			evicted ? "yes" : "no", LRU_Count(&cache));
+		LRU_Put(&cache, 3, 33, 0);
+		LRU_Get(&cache, 3, &value);
+		int removed = LRU_Remove(&cache, 4);
+		int removedAgain = LRU_Remove(&cache, 4);
+		printf("Updated key 3: %d, removed key 4: %s, removed again: %s.\n", value,
+			removed ? "yes" : "no", removedAgain ? "yes" : "no");
+		printf("Hits %llu, misses %llu, evictions %llu.\n", cache.hits, cache.misses, cache.evictions);
+		LRU_Dispose(&cache);
+
+		LRU_Init(&cache, 0, 100);
+		LRU_Put(&cache, 1, 1, 60);
+		LRU_Put(&cache, 2, 2, 30);
+		LRU_Put(&cache, 3, 3, 30);
+		printf("Byte limit: count %zu, bytes %zu, key 1 evicted: %s.\n", LRU_Count(&cache), cache.bytes,
+			LRU_Get(&cache, 1, &value) ? "no" : "yes");
+		LRU_Put(&cache, 4, 4, 500);
+		printf("Oversized entry: count %zu, bytes %zu, evictions %llu.\n", LRU_Count(&cache), cache.bytes,
+			cache.evictions);
+		LRU_Dispose(&cache);
+
+		LRU_Init(&cache, 16, 0);
+		printf("Random operations, entry limit: %d mismatches", compare_lru_with_model(&cache, 20000));
+		printf(", evictions: %s.\n", cache.evictions > 0 ? "yes" : "no");
+		LRU_Dispose(&cache);
+		LRU_Init(&cache, 0, 150);
+		printf("Random operations, byte limit: %d mismatches", compare_lru_with_model(&cache, 20000));
+		printf(", table grown: %s.\n", cache.slotMask + 1 > 16 ? "yes" : "no");
+		LRU_Dispose(&cache);
+		LRU_Init(&cache, 0, 0);
+		printf("Random operations, no limit: %d mismatches.\n", compare_lru_with_model(&cache, 20000));
+		LRU_Dispose(&cache);
+	}
+
+	printf("\n[TEST51]\n");
+	printf("A list generated by DLL_DEFINE for int behaves exactly like DLList.\n");
+	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+	{
+		IntList generated;
+		IntList_Init(&generated);
+		printf("Mismatches: %d\n", compare_with_dllist(100000, &generated, apply_to_int_list, dump_int_list));
+		IntList_Dispose(&generated);
+		printf("After dispose: length %d, active: %s.\n", IntList_Length(&generated),
+			IntList_IsActive(&generated) ? "yes" : "no");
+	}
+
+	printf("\n[TEST52]\n");
+	printf("A list generated by DLL_DEFINE embeds whole records in its elements.\n");
+	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+	{
+		RecordList records;
+		RecordList_Init(&records);
+		RecordList_InsertLast(&records, (Record) { 2, 2.5, "second" });
+		RecordList_InsertFirst(&records, (Record) { 1, 1.5, "first" });
+		RecordList_InsertLast(&records, (Record) { 3, 3.5, "third" });
+		RecordList_First(&records);
+		Record *value = RecordList_ValuePtr(&records);
+		if (value != NULL)
+			value->weight *= 10;
+		RecordList_Next(&records);
+		value = RecordList_ValuePtr(&records);
+		if (value != NULL)
+			strcpy(value->name, "changed");
+		RecordList_DeleteAfter(&records);
+		RecordList_InsertAfter(&records, (Record) { 4, 4.5, "fourth" });
+		for (RecordList_First(&records); RecordList_IsActive(&records); RecordList_Next(&records))
+		{
+			Record record;
+			RecordList_GetValue(&records, &record);
+			printf("Record %d: weight %.1f, name %s.\n", record.id, record.weight, record.name);
+		}
+		printf("Element size: %s.\n", sizeof(RecordListElement) == 2 * sizeof(void *) + sizeof(Record) ?
+			"links plus record" : "padded");
+		Record record = { 0, 0, "" };
+		RecordList_GetLast(&records, &record);
+		RecordList_DeleteFirst(&records);
+		RecordList_DeleteFirst(&records);
+		RecordList_DeleteFirst(&records);
+		printf("Last was %d, length after deleting all %d, value of the empty list: ", record.id,
+			RecordList_Length(&records));
+		RecordList_GetFirst(&records, &record);
+		error_flag = FALSE;
+		RecordList_Dispose(&records);
+	}
+
+	printf("\n[TEST53]\n");
+	printf("An intrusive list behaves exactly like DLList without allocating.\n");
+	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+	{
+		static IntrusiveVariant variant;
+		IDLL_Init(&variant.list);
+		IDLL_Init(&variant.freeItems);
+		for (int i = 0; i <= RANDOM_MAX_LENGTH; i++)
+			IDLL_InsertLast(&variant.freeItems, &variant.items[i].link);
+		printf("Mismatches: %d\n", compare_with_dllist(100000, &variant, apply_to_intrusive_list, dump_intrusive_list));
+		printf("Objects in the list and free: %d\n", IDLL_Length(&variant.list) + IDLL_Length(&variant.freeItems));
+	}
+
+	printf("\n[TEST54]\n");
+	printf("Objects can be in two intrusive lists at once.\n");
+	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+	{
+		IntItem items[5];
+		IDLList all, odd;
+		IDLL_Init(&all);
+		IDLL_Init(&odd);
+		for (int i = 0; i < 5; i++)
+		{
+			items[i].value = i + 1;
+			IDLL_InsertLast(&all, &items[i].link);
+			if (items[i].value % 2 == 1)
+				IDLL_InsertFirst(&odd, &items[i].otherLink);
+		}
+		print_intrusive_list(&all, offsetof(IntItem, link));
+		print_intrusive_list(&odd, offsetof(IntItem, otherLink));
+
+		// Removing the object 3 from the first list leaves it in the second one
+		IDLL_Remove(&all, &items[2].link);
+		IDLL_First(&odd);
+		IDLL_Next(&odd);
+		IntItem *item = IDLL_ENTRY(IDLL_GetValue(&odd), IntItem, otherLink);
+		printf("Second odd object: %d, lengths %d and %d.\n", item->value, IDLL_Length(&all), IDLL_Length(&odd));
+		IDLL_InsertBefore(&odd, &items[1].otherLink);
+		IDLL_DeleteAfter(&odd);
+		print_intrusive_list(&odd, offsetof(IntItem, otherLink));
+		item = IDLL_ENTRY(IDLL_GetLast(&all), IntItem, link);
+		printf("Last of all: %d, same object as items[4]: %s.\n", item->value, item == &items[4] ? "yes" : "no");
+
+		IDLL_Dispose(&all);
+		int cleared = 0;
+		for (int i = 0; i < 5; i++)
+			cleared += items[i].link.previousLink == NULL && items[i].link.nextLink == NULL;
+		printf("Links cleared by the dispose: %d of 5.\n", cleared);
+		printf("First of the disposed list: ");
+		IDLLink *link = IDLL_GetFirst(&all);
+		printf("Returned link: %s.\n", link == NULL ? "none" : "some");
+		error_flag = FALSE;
+	}
+
+	printf("\n[TEST55]\n");
+	printf("A list with inline storage behaves exactly like DLList, short and long.\n");
+	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+	{
+		SDLList small;
+		SDLL_Init(&small);
+		random_max_length = SDLL_INLINE;
+		printf("Mismatches while inline: %d", compare_with_dllist(20000, &small, apply_to_small_list, dump_small_list));
+		printf(", spilled: %s.\n", SDLL_IsSpilled(&small) ? "yes" : "no");
+		random_max_length = RANDOM_MAX_LENGTH;
+		SDLL_Dispose(&small);
+		printf("Mismatches while growing: %d", compare_with_dllist(100000, &small, apply_to_small_list, dump_small_list));
+		printf(", spilled: %s.\n", SDLL_IsSpilled(&small) ? "yes" : "no");
+		SDLL_Dispose(&small);
+		printf("After dispose: length %d, spilled: %s.\n", SDLL_Length(&small), SDLL_IsSpilled(&small) ? "yes" : "no");
+	}
+
+	printf("\n[TEST56]\n");
+	printf("A list with inline storage moves to heap elements past SDLL_INLINE values.\n");
+	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+	{
+		SDLList small;
+		SDLL_Init(&small);
+		for (int i = 1; i < SDLL_INLINE; i++)
+			SDLL_InsertLast(&small, i * 10);
+		SDLL_First(&small);
+		SDLL_Next(&small);
+		SDLL_InsertBefore(&small, 15);
+		print_small_list(&small);
+
+		// The active element survives the move to heap elements
+		SDLL_Last(&small);
+		SDLL_Previous(&small);
+		SDLL_InsertAfter(&small, 65);
+		int value;
+		SDLL_GetValue(&small, &value);
+		printf("Active value after the move: %d\n", value);
+		SDLL_DeleteFirst(&small);
+		print_small_list(&small);
+		printf("Structure size: %s a DLList with two elements.\n",
+			sizeof(SDLList) < sizeof(DLList) + 2 * sizeof(struct DLLElement) ? "smaller than" : "not smaller than");
+
+		SDLL_Dispose(&small);
+		printf("Value of the disposed list: ");
+		SDLL_GetLast(&small, &value);
+		printf("Error reported: %s.\n", error_flag ? "yes" : "no");
+		error_flag = FALSE;
+	}
+
+	printf("\n[TEST57]\n");
+	printf("DLL_DisposeAsync empties lists at once and frees their elements in the background.\n");
+	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+	{
+		DLLReclaimer reclaimer;
+		DLLReclaimer_Init(&reclaimer, 2);
+		DLList lists[10];
+		for (int i = 0; i < 10; i++)
+		{
+			DLL_Init(&lists[i]);
+			for (int j = 0; j < 1000; j++)
+				DLL_InsertLast(&lists[i], j);
+		}
+		DLL_First(&lists[0]);
+		for (int i = 0; i < 10; i++)
+			DLL_DisposeAsync(&lists[i], &reclaimer);
+		printf("First list: empty: %s, active: %s.\n", lists[0].firstElement == NULL ? "yes" : "no",
+			DLL_IsActive(&lists[0]) ? "yes" : "no");
+
+		// A disposed list is immediately usable again
+		DLL_InsertLast(&lists[0], 42);
+		int value = 0;
+		DLL_GetFirst(&lists[0], &value);
+		printf("Reused list: first value %d, single element: %s.\n", value,
+			lists[0].firstElement == lists[0].lastElement ? "yes" : "no");
+
+		DLLReclaimer_Drain(&reclaimer);
+		DLLReclaimerStats stats;
+		DLLReclaimer_Stats(&reclaimer, &stats);
+		printf("Lists queued %llu, reclaimed %llu, elements %llu, pending %zu, queue bound kept: %s.\n",
+			stats.listsQueued, stats.listsReclaimed, stats.elementsReclaimed, stats.pending,
+			stats.maxQueued <= 2 ? "yes" : "no");
+
+		// An empty list is disposed of directly
+		DLL_DisposeAsync(&lists[1], &reclaimer);
+		DLLReclaimer_Stats(&reclaimer, &stats);
+		printf("After an empty list: queued %llu.\n", stats.listsQueued);
+
+		// Lists still queued are freed when the reclaimer is disposed of
+		DLL_DisposeAsync(&lists[0], &reclaimer);
+		DLLReclaimer_Dispose(&reclaimer);
+		printf("Reclaimer disposed.\n");
+	}
+
+	printf("\n[TEST58]\n");
+	printf("The seek index follows cursor edits, moves, splits, splices and sorts.\n");
+	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+	for (int stride = 1; stride <= 64; stride *= 8)
+		printf("Seek index of stride %d: %d mismatches.\n", stride, check_seek_moves(20000, stride));
+
+	printf("\n[TEST59]\n");
+	printf("XDLL_Compact releases the slabs it empties, DLLPool_Trim those left unused.\n");
+	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+	{
+		DLLPool pool;
+		DLLPool_Init(&pool, 4);
+		XDLList other, list;
+		XDLL_InitPooled(&other, &pool);
+		XDLL_InitPooled(&list, &pool);
+		XDLL_InsertLast(&other, 1);
+		for (int i = 0; i < 100; i++)
+		{
+			if (i % 2)
+				XDLL_InsertLast(&list, i);
+			else
+				XDLL_InsertFirst(&list, i);
+		}
+		printf("Before compacting: slabs %d, free elements %d.\n", count_slabs(&pool), count_free_elements(&pool));
+		printf("Slabs after each of 5 compactions:");
+		for (int i = 0; i < 5; i++)
+		{
+			XDLL_Compact(&list);
+			printf(" %d", count_slabs(&pool));
+		}
+		printf(", free elements: %d (counted %d).\n", (int) pool.freeCount, count_free_elements(&pool));
+		XDLL_Dispose(&other);
+		DLLPool_Trim(&pool);
+		printf("After trimming without the other list: slabs %d, free elements %d.\n",
+			count_slabs(&pool), count_free_elements(&pool));
+		XDLL_Dispose(&list);
+		DLLPool_Trim(&pool);
+		printf("After trimming without any list: slabs %d, free elements %d.\n",
+			count_slabs(&pool), (int) pool.freeCount);
+		DLLPool_Dispose(&pool);
+	}
+
 	printf("\n----- C206 - The End of Basic Tests -----\n");
 
 	return (0);
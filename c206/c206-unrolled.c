@@ -0,0 +1,581 @@
+/**
+ * @file c206-unrolled.c
+ * @brief Implementation of the unrolled doubly linked list.
+ * @details Implements the UDLL_* operations declared in c206-unrolled.h. The position of
+ *          a value is a pair of its node and its index within the node; the active
+ *          element is tracked the same way. All structural work is done by two helpers:
+ *          UDLL_InsertAt, which splits a full node, and UDLL_DeleteAt, which releases an
+ *          empty node or merges a sparse one into its neighbour. Both keep the active
+ *          position pointing to the same value.
+ *
+ * @code
+ * // Example usage:
+ * UDLList list;
+ * UDLL_Init(&list);
+ * for (int i = 0; i < 1000000; i++) {
+ *     UDLL_InsertLast(&list, i);
+ * }
+ * long sum = 0;
+ * for (UDLL_First(&list); UDLL_IsActive(&list); UDLL_Next(&list)) {
+ *     int value;
+ *     UDLL_GetValue(&list, &value);
+ *     sum += value;
+ * }
+ * UDLL_Dispose(&list);
+ * @endcode
+ *
+ * @see c206-unrolled.h for definition of constants and types.
+ *
+ * @see https://github.com/Jekwwer/IAL-Project01-2021 for the project repository.
+ */
+
+#include "c206-unrolled.h"
+#include <string.h>
+
+/** Number of values in one node as a signed integer. */
+#define CAPACITY ((int) UDLL_NODE_CAPACITY)
+
+/**
+ * @brief Allocates an empty node and links it into the list.
+ *
+ * @param list Pointer to the initialized unrolled list.
+ * @param previousNode Node after which the new node is linked, or NULL to link it as
+ *                     the first node.
+ *
+ * @retval UDLLNodePtr The new node, or NULL if the allocation failed.
+ */
+static UDLLNodePtr UDLL_NewNode(UDLList *list, UDLLNodePtr previousNode) {
+
+    UDLLNodePtr node = (UDLLNodePtr) malloc(sizeof(struct UDLLNode));
+    if (node == NULL) {
+        return NULL;
+    }
+
+    node->count = 0;
+    node->previousNode = previousNode;
+    node->nextNode = previousNode != NULL ? previousNode->nextNode : list->firstNode;
+
+    if (node->nextNode != NULL) {
+        node->nextNode->previousNode = node;
+    } else {
+        list->lastNode = node;
+    }
+    if (previousNode != NULL) {
+        previousNode->nextNode = node;
+    } else {
+        list->firstNode = node;
+    }
+    return node;
+}
+
+/**
+ * @brief Unlinks a node from the list and frees it.
+ *
+ * @param list Pointer to the initialized unrolled list.
+ * @param node The node to remove; the active element must not be in it.
+ */
+static void UDLL_FreeNode(UDLList *list, UDLLNodePtr node) {
+
+    if (node->previousNode != NULL) {
+        node->previousNode->nextNode = node->nextNode;
+    } else {
+        list->firstNode = node->nextNode;
+    }
+    if (node->nextNode != NULL) {
+        node->nextNode->previousNode = node->previousNode;
+    } else {
+        list->lastNode = node->previousNode;
+    }
+    free(node);
+}
+
+/**
+ * @brief Inserts a value at the given position of a node.
+ *
+ * @details A full node is not split when the value goes to either of its ends and the
+ *          neighbouring node has room, or when a new node can simply be linked next to
+ *          it; this keeps nodes filled by InsertFirst and InsertLast completely full.
+ *          Otherwise the upper half of the node is moved into a new node.
+ *
+ * @param list Pointer to the initialized unrolled list.
+ * @param node The node, or NULL if the list is empty.
+ * @param index Index the value will have within the node, from 0 to node->count.
+ * @param data The value to insert.
+ *
+ * @post The value is inserted and the active position still refers to the same value.
+ *       If a node cannot be allocated, DLL_Error is called and the list is unchanged.
+ */
+static void UDLL_InsertAt(UDLList *list, UDLLNodePtr node, int index, int data) {
+
+    if (node == NULL) {
+        node = UDLL_NewNode(list, NULL);
+        if (node == NULL) {
+            DLL_Error();
+            return;
+        }
+        index = 0;
+    } else if (node->count == CAPACITY) {
+        UDLLNodePtr target;
+
+        if (index == CAPACITY) {
+            // Appending behind a full node
+            target = node->nextNode != NULL && node->nextNode->count < CAPACITY
+                             ? node->nextNode
+                             : UDLL_NewNode(list, node);
+            index = 0;
+        } else if (index == 0) {
+            // Prepending in front of a full node
+            target = node->previousNode != NULL && node->previousNode->count < CAPACITY
+                             ? node->previousNode
+                             : UDLL_NewNode(list, node->previousNode);
+            index = target != NULL ? target->count : 0;
+        } else {
+            // Splitting the full node in halves
+            target = UDLL_NewNode(list, node);
+            if (target != NULL) {
+                int half = CAPACITY / 2;
+                memcpy(target->data, &node->data[half], sizeof(int) * (CAPACITY - half));
+                target->count = CAPACITY - half;
+                node->count = half;
+
+                if (list->activeNode == node && list->activeIndex >= half) {
+                    list->activeNode = target;
+                    list->activeIndex -= half;
+                }
+                if (index > half) {
+                    index -= half;
+                } else {
+                    target = node;
+                }
+            }
+        }
+
+        if (target == NULL) {
+            DLL_Error();
+            return;
+        }
+        node = target;
+    }
+
+    memmove(&node->data[index + 1], &node->data[index], sizeof(int) * (node->count - index));
+    node->data[index] = data;
+    node->count++;
+
+    if (list->activeNode == node && list->activeIndex >= index) {
+        list->activeIndex++;
+    }
+}
+
+/**
+ * @brief Removes the value at the given position of a node.
+ *
+ * @details An emptied node is released. A node that drops below half of its capacity
+ *          is merged with a neighbour when their values fit into one node.
+ *
+ * @param list Pointer to the initialized unrolled list.
+ * @param node The node holding the value.
+ * @param index Index of the value within the node.
+ *
+ * @pre The value must not be the active element.
+ *
+ * @post The value is removed and the active position still refers to the same value.
+ */
+static void UDLL_DeleteAt(UDLList *list, UDLLNodePtr node, int index) {
+
+    memmove(&node->data[index], &node->data[index + 1], sizeof(int) * (node->count - index - 1));
+    node->count--;
+
+    if (list->activeNode == node && list->activeIndex > index) {
+        list->activeIndex--;
+    }
+
+    if (node->count == 0) {
+        UDLL_FreeNode(list, node);
+        return;
+    }
+    if (node->count >= CAPACITY / 2) {
+        return;
+    }
+
+    // Merge the right one of the two nodes into the left one
+    UDLLNodePtr left = node->previousNode;
+    UDLLNodePtr right = node;
+    if (node->nextNode != NULL && (left == NULL || node->nextNode->count < left->count)) {
+        left = node;
+        right = node->nextNode;
+    }
+    if (left == NULL || left->count + right->count > CAPACITY) {
+        return;
+    }
+
+    memcpy(&left->data[left->count], right->data, sizeof(int) * right->count);
+    if (list->activeNode == right) {
+        list->activeNode = left;
+        list->activeIndex += left->count;
+    }
+    left->count += right->count;
+    UDLL_FreeNode(list, right);
+}
+
+/**
+ * @brief Initializes the unrolled list.
+ *
+ * @param list Pointer to the unrolled list structure to be initialized.
+ *
+ * @post The list is empty and inactive.
+ *
+ * @return This function does not return a value.
+ */
+void UDLL_Init(UDLList *list) {
+
+    list->firstNode = NULL;
+    list->lastNode = NULL;
+    list->activeNode = NULL;
+    list->activeIndex = 0;
+}
+
+/**
+ * @brief Deletes all values from the unrolled list and reinitializes it.
+ *
+ * @details Frees the list node by node, which is one free per UDLL_NODE_CAPACITY values.
+ *
+ * @param list Pointer to the initialized unrolled list.
+ *
+ * @post The list is in the same state as after UDLL_Init.
+ *
+ * @return This function does not return a value.
+ */
+void UDLL_Dispose(UDLList *list) {
+
+    while (list->firstNode != NULL) {
+        UDLLNodePtr node = list->firstNode;
+        list->firstNode = node->nextNode;
+        free(node);
+    }
+    UDLL_Init(list);
+}
+
+/**
+ * @brief Inserts a new value at the beginning of the list.
+ *
+ * @param list Pointer to the initialized unrolled list.
+ * @param data Value to be inserted.
+ *
+ * @post The value is the first one of the list. If memory allocation fails, DLL_Error is
+ *       called and the list is unchanged.
+ *
+ * @return This function does not return a value.
+ */
+void UDLL_InsertFirst(UDLList *list, int data) {
+
+    UDLL_InsertAt(list, list->firstNode, 0, data);
+}
+
+/**
+ * @brief Inserts a new value at the end of the list.
+ *
+ * @param list Pointer to the initialized unrolled list.
+ * @param data Value to be inserted.
+ *
+ * @post The value is the last one of the list. If memory allocation fails, DLL_Error is
+ *       called and the list is unchanged.
+ *
+ * @return This function does not return a value.
+ */
+void UDLL_InsertLast(UDLList *list, int data) {
+
+    UDLL_InsertAt(list, list->lastNode, list->lastNode != NULL ? list->lastNode->count : 0, data);
+}
+
+/**
+ * @brief Sets the first value of the list as active.
+ *
+ * @param list Pointer to the initialized unrolled list.
+ *
+ * @post The first value is active, or the list stays inactive if it is empty.
+ *
+ * @return This function does not return a value.
+ */
+void UDLL_First(UDLList *list) {
+
+    list->activeNode = list->firstNode;
+    list->activeIndex = 0;
+}
+
+/**
+ * @brief Sets the last value of the list as active.
+ *
+ * @param list Pointer to the initialized unrolled list.
+ *
+ * @post The last value is active, or the list stays inactive if it is empty.
+ *
+ * @return This function does not return a value.
+ */
+void UDLL_Last(UDLList *list) {
+
+    list->activeNode = list->lastNode;
+    list->activeIndex = list->lastNode != NULL ? list->lastNode->count - 1 : 0;
+}
+
+/**
+ * @brief Returns the first value of the list.
+ *
+ * @param list Pointer to the initialized unrolled list.
+ * @param dataPtr Pointer to the destination variable.
+ *
+ * @post If the list is empty, DLL_Error is called and the variable is left untouched.
+ *
+ * @return This function does not return a value.
+ */
+void UDLL_GetFirst(UDLList *list, int *dataPtr) {
+
+    if (list->firstNode == NULL) {
+        DLL_Error();
+    } else {
+        *dataPtr = list->firstNode->data[0];
+    }
+}
+
+/**
+ * @brief Returns the last value of the list.
+ *
+ * @param list Pointer to the initialized unrolled list.
+ * @param dataPtr Pointer to the destination variable.
+ *
+ * @post If the list is empty, DLL_Error is called and the variable is left untouched.
+ *
+ * @return This function does not return a value.
+ */
+void UDLL_GetLast(UDLList *list, int *dataPtr) {
+
+    if (list->lastNode == NULL) {
+        DLL_Error();
+    } else {
+        *dataPtr = list->lastNode->data[list->lastNode->count - 1];
+    }
+}
+
+/**
+ * @brief Deletes the first value of the list.
+ *
+ * @param list Pointer to the initialized unrolled list.
+ *
+ * @post If the first value was active, the list becomes inactive. Nothing happens if
+ *       the list is empty.
+ *
+ * @return This function does not return a value.
+ */
+void UDLL_DeleteFirst(UDLList *list) {
+
+    if (list->firstNode == NULL) {
+        return;
+    }
+    if (list->activeNode == list->firstNode && list->activeIndex == 0) {
+        list->activeNode = NULL;
+    }
+    UDLL_DeleteAt(list, list->firstNode, 0);
+}
+
+/**
+ * @brief Deletes the last value of the list.
+ *
+ * @param list Pointer to the initialized unrolled list.
+ *
+ * @post If the last value was active, the list becomes inactive. Nothing happens if
+ *       the list is empty.
+ *
+ * @return This function does not return a value.
+ */
+void UDLL_DeleteLast(UDLList *list) {
+
+    if (list->lastNode == NULL) {
+        return;
+    }
+    int index = list->lastNode->count - 1;
+    if (list->activeNode == list->lastNode && list->activeIndex == index) {
+        list->activeNode = NULL;
+    }
+    UDLL_DeleteAt(list, list->lastNode, index);
+}
+
+/**
+ * @brief Deletes the value following the active one.
+ *
+ * @param list Pointer to the initialized unrolled list.
+ *
+ * @post Nothing happens if the list is inactive or the active value is the last one.
+ *
+ * @return This function does not return a value.
+ */
+void UDLL_DeleteAfter(UDLList *list) {
+
+    if (!UDLL_IsActive(list)) {
+        return;
+    }
+
+    if (list->activeIndex + 1 < list->activeNode->count) {
+        UDLL_DeleteAt(list, list->activeNode, list->activeIndex + 1);
+    } else if (list->activeNode->nextNode != NULL) {
+        UDLL_DeleteAt(list, list->activeNode->nextNode, 0);
+    }
+}
+
+/**
+ * @brief Deletes the value preceding the active one.
+ *
+ * @param list Pointer to the initialized unrolled list.
+ *
+ * @post Nothing happens if the list is inactive or the active value is the first one.
+ *
+ * @return This function does not return a value.
+ */
+void UDLL_DeleteBefore(UDLList *list) {
+
+    if (!UDLL_IsActive(list)) {
+        return;
+    }
+
+    if (list->activeIndex > 0) {
+        UDLL_DeleteAt(list, list->activeNode, list->activeIndex - 1);
+    } else if (list->activeNode->previousNode != NULL) {
+        UDLLNodePtr previous = list->activeNode->previousNode;
+        UDLL_DeleteAt(list, previous, previous->count - 1);
+    }
+}
+
+/**
+ * @brief Inserts a new value after the active one.
+ *
+ * @param list Pointer to the initialized unrolled list.
+ * @param data Value to be inserted.
+ *
+ * @post Nothing happens if the list is inactive. The active value does not change.
+ *
+ * @return This function does not return a value.
+ */
+void UDLL_InsertAfter(UDLList *list, int data) {
+
+    if (!UDLL_IsActive(list)) {
+        return;
+    }
+    UDLL_InsertAt(list, list->activeNode, list->activeIndex + 1, data);
+}
+
+/**
+ * @brief Inserts a new value before the active one.
+ *
+ * @param list Pointer to the initialized unrolled list.
+ * @param data Value to be inserted.
+ *
+ * @post Nothing happens if the list is inactive. The active value does not change.
+ *
+ * @return This function does not return a value.
+ */
+void UDLL_InsertBefore(UDLList *list, int data) {
+
+    if (!UDLL_IsActive(list)) {
+        return;
+    }
+    UDLL_InsertAt(list, list->activeNode, list->activeIndex, data);
+}
+
+/**
+ * @brief Returns the active value.
+ *
+ * @param list Pointer to the initialized unrolled list.
+ * @param dataPtr Pointer to the destination variable.
+ *
+ * @post If the list is inactive, DLL_Error is called and the variable is left untouched.
+ *
+ * @return This function does not return a value.
+ */
+void UDLL_GetValue(UDLList *list, int *dataPtr) {
+
+    if (!UDLL_IsActive(list)) {
+        DLL_Error();
+    } else {
+        *dataPtr = list->activeNode->data[list->activeIndex];
+    }
+}
+
+/**
+ * @brief Overwrites the active value.
+ *
+ * @param list Pointer to the initialized unrolled list.
+ * @param data New value.
+ *
+ * @post Nothing happens if the list is inactive.
+ *
+ * @return This function does not return a value.
+ */
+void UDLL_SetValue(UDLList *list, int data) {
+
+    if (UDLL_IsActive(list)) {
+        list->activeNode->data[list->activeIndex] = data;
+    }
+}
+
+/**
+ * @brief Moves the activity to the next value.
+ *
+ * @details Within a node this is just an index increment; the next node is loaded only
+ *          after the last value of the current one.
+ *
+ * @param list Pointer to the initialized unrolled list.
+ *
+ * @post The list becomes inactive after its last value. Nothing happens if the list is
+ *       inactive.
+ *
+ * @return This function does not return a value.
+ */
+void UDLL_Next(UDLList *list) {
+
+    if (!UDLL_IsActive(list)) {
+        return;
+    }
+
+    if (list->activeIndex + 1 < list->activeNode->count) {
+        list->activeIndex++;
+    } else {
+        list->activeNode = list->activeNode->nextNode;
+        list->activeIndex = 0;
+    }
+}
+
+/**
+ * @brief Moves the activity to the previous value.
+ *
+ * @param list Pointer to the initialized unrolled list.
+ *
+ * @post The list becomes inactive before its first value. Nothing happens if the list
+ *       is inactive.
+ *
+ * @return This function does not return a value.
+ */
+void UDLL_Previous(UDLList *list) {
+
+    if (!UDLL_IsActive(list)) {
+        return;
+    }
+
+    if (list->activeIndex > 0) {
+        list->activeIndex--;
+    } else {
+        list->activeNode = list->activeNode->previousNode;
+        list->activeIndex = list->activeNode != NULL ? list->activeNode->count - 1 : 0;
+    }
+}
+
+/**
+ * @brief Checks whether the list is active.
+ *
+ * @param list Pointer to the initialized unrolled list.
+ *
+ * @retval int Returns a non-zero value if the list has an active value, otherwise zero.
+ */
+int UDLL_IsActive(UDLList *list) {
+
+    return list->activeNode != NULL;
+}
+
+/* End of c206-unrolled.c */
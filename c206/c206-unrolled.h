@@ -0,0 +1,90 @@
+/**
+ * @file c206-unrolled.h
+ * @brief Unrolled doubly linked list of integers.
+ * @details Declares a list variant whose nodes hold a small array of values instead of
+ *          a single one. A node occupies two cache lines, so a sequential scan touches
+ *          one new node per UDLL_NODE_CAPACITY values rather than one per value.
+ *
+ *          The operations mirror the DLL_* operations of c206.h one to one, including
+ *          the single active element, so code using DLList can switch to UDLList by
+ *          renaming the calls. Full nodes are split on insertion and a node that drops
+ *          below half of its capacity is merged with a neighbour when both fit into one.
+ *
+ * @see c206.h for the list the variant mirrors.
+ *
+ * @see https://github.com/Jekwwer/IAL-Project01-2021 for the project repository.
+ */
+
+#ifndef _UDLL_H_
+#define _UDLL_H_
+
+#include "c206-ext.h"
+
+/** Number of values in one node, chosen so that a node fills two 64-byte cache lines. */
+#define UDLL_NODE_CAPACITY ((128 - 2 * sizeof(void *) - sizeof(int)) / sizeof(int))
+
+/** Node of the unrolled list. */
+typedef struct UDLLNode {
+	/** Pointer to the previous node in the list. */
+	struct UDLLNode *previousNode;
+	/** Pointer to the next node in the list. */
+	struct UDLLNode *nextNode;
+	/** Number of values used in the node. */
+	int count;
+	/** Useful data, the values 0 to count - 1 are valid. */
+	int data[UDLL_NODE_CAPACITY];
+} *UDLLNodePtr;
+
+/** Unrolled doubly linked list. */
+typedef struct {
+	/** Pointer to the first node in the list. */
+	UDLLNodePtr firstNode;
+	/** Pointer to the last node in the list. */
+	UDLLNodePtr lastNode;
+	/** Pointer to the node holding the active element, or NULL if the list is inactive. */
+	UDLLNodePtr activeNode;
+	/** Index of the active element within the active node. */
+	int activeIndex;
+} UDLList;
+
+void UDLL_Init( UDLList * );
+
+void UDLL_Dispose( UDLList * );
+
+void UDLL_InsertFirst( UDLList *, int );
+
+void UDLL_InsertLast( UDLList *, int );
+
+void UDLL_First( UDLList * );
+
+void UDLL_Last( UDLList * );
+
+void UDLL_GetFirst( UDLList *, int * );
+
+void UDLL_GetLast( UDLList *, int * );
+
+void UDLL_DeleteFirst( UDLList * );
+
+void UDLL_DeleteLast( UDLList * );
+
+void UDLL_DeleteAfter( UDLList * );
+
+void UDLL_DeleteBefore( UDLList * );
+
+void UDLL_InsertAfter( UDLList *, int );
+
+void UDLL_InsertBefore( UDLList *, int );
+
+void UDLL_GetValue( UDLList *, int * );
+
+void UDLL_SetValue( UDLList *, int );
+
+void UDLL_Next( UDLList * );
+
+void UDLL_Previous( UDLList * );
+
+int UDLL_IsActive( UDLList * );
+
+#endif
+
+/* End of c206-unrolled.h */